@@ -0,0 +1,343 @@
+// Genere par chip8-aot a partir de 1-chip8-logo.ch8 : ne pas modifier.
+// 260 bytes, 40 instructions traduites, 0 saut(s) indirect(s) BNNN
+
+#include "chip8_native.hpp"
+#include "latency.hpp"
+
+const uint8_t Chip8Native::ROM[] = {
+    0x00, 0xE0, 0x61, 0x01, 0x60, 0x08, 0xA2, 0x50, 0xD0, 0x1F, 0x60, 0x10,
+    0xA2, 0x5F, 0xD0, 0x1F, 0x60, 0x18, 0xA2, 0x6E, 0xD0, 0x1F, 0x60, 0x20,
+    0xA2, 0x7D, 0xD0, 0x1F, 0x60, 0x28, 0xA2, 0x8C, 0xD0, 0x1F, 0x60, 0x30,
+    0xA2, 0x9B, 0xD0, 0x1F, 0x61, 0x10, 0x60, 0x08, 0xA2, 0xAA, 0xD0, 0x1F,
+    0x60, 0x10, 0xA2, 0xB9, 0xD0, 0x1F, 0x60, 0x18, 0xA2, 0xC8, 0xD0, 0x1F,
+    0x60, 0x20, 0xA2, 0xD7, 0xD0, 0x1F, 0x60, 0x28, 0xA2, 0xE6, 0xD0, 0x1F,
+    0x60, 0x30, 0xA2, 0xF5, 0xD0, 0x1F, 0x12, 0x4E, 0x0F, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x00, 0x00, 0x1F, 0x3F, 0x71, 0xE0, 0xE5, 0xE0, 0xE8, 0xA0,
+    0x0D, 0x2A, 0x28, 0x28, 0x28, 0x00, 0x00, 0x18, 0xB8, 0xB8, 0x38, 0x38,
+    0x3F, 0xBF, 0x00, 0x19, 0xA5, 0xBD, 0xA1, 0x9D, 0x00, 0x00, 0x0C, 0x1D,
+    0x1D, 0x01, 0x0D, 0x1D, 0x9D, 0x01, 0xC7, 0x29, 0x29, 0x29, 0x27, 0x00,
+    0x00, 0xF8, 0xFC, 0xCE, 0xC6, 0xC6, 0xC6, 0xC6, 0x00, 0x49, 0x4A, 0x49,
+    0x48, 0x3B, 0x00, 0x00, 0x00, 0x01, 0x03, 0x03, 0x03, 0x01, 0xF0, 0x30,
+    0x90, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0xFE, 0xC7, 0x83, 0x83, 0x83,
+    0xC6, 0xFC, 0xE7, 0xE0, 0xE0, 0xE0, 0xE0, 0x71, 0x3F, 0x1F, 0x00, 0x00,
+    0x07, 0x02, 0x02, 0x02, 0x02, 0x39, 0x38, 0x38, 0x38, 0x38, 0xB8, 0xB8,
+    0x38, 0x00, 0x00, 0x31, 0x4A, 0x79, 0x40, 0x3B, 0xDD, 0xDD, 0xDD, 0xDD,
+    0xDD, 0xDD, 0xDD, 0xDD, 0x00, 0x00, 0xA0, 0x38, 0x20, 0xA0, 0x18, 0xCE,
+    0xFC, 0xF8, 0xC0, 0xD4, 0xDC, 0xC4, 0xC5, 0x00, 0x00, 0x30, 0x44, 0x24,
+    0x14, 0x63, 0xF1, 0x03, 0x07, 0x07, 0x77, 0x17, 0x63, 0x71, 0x00, 0x00,
+    0x28, 0x8E, 0xA8, 0xA8, 0xA6, 0xCE, 0x87, 0x03, 0x03, 0x03, 0x87, 0xFE,
+    0xFC, 0x00, 0x00, 0x60, 0x90, 0xF0, 0x80, 0x70,
+};
+const size_t Chip8Native::ROM_SIZE = sizeof(Chip8Native::ROM);
+const char *const Chip8Native::ROM_NAME = "1-chip8-logo";
+
+// Adresses traduites (1 bit par adresse)
+static const uint8_t CODE_MAP[Chip8::MEMORY_SIZE / 8] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static bool isCode(unsigned addr) {
+  return addr < Chip8::MEMORY_SIZE && ((CODE_MAP[addr >> 3] >> (addr & 7)) & 1);
+}
+
+bool Chip8Native::codeIntact(unsigned first, unsigned count) const {
+  for (unsigned a = first; a < first + count && a < Chip8::MEMORY_SIZE; ++a) {
+    // Une instruction couvre les octets a et a + 1
+    bool covered = isCode(a) || (a > 0 && isCode(a - 1));
+    if (covered && chip8.memory[a] != ROM[a - Chip8::START_ADDRESS])
+      return false;
+  }
+  return true;
+}
+
+void Chip8Native::reset() {
+  valid = codeIntact(Chip8::START_ADDRESS, static_cast<unsigned>(ROM_SIZE));
+}
+
+void Chip8Native::checkStore(uint16_t opcode) {
+  unsigned count = 0;
+  if ((opcode & 0xF0FF) == 0xF033)
+    count = 3;
+  else if ((opcode & 0xF0FF) == 0xF055)
+    count = ((opcode >> 8) & 0x0F) + 1;
+
+  if (count && !codeIntact(chip8.I, count))
+    valid = false;
+}
+
+// Budget epuise : on s'arrete avant l'instruction addr
+#define STEP(addr)                                                             \
+  if (executed == budget) {                                                    \
+    c.pc = addr;                                                               \
+    return executed;                                                           \
+  }                                                                            \
+  ++executed;
+
+int Chip8Native::run(int budget) {
+  Chip8 &c = chip8;
+  int executed = 0;
+
+  while (executed < budget) {
+    if (valid) {
+      switch (c.pc) {
+      case 0x200:
+        goto L_200;
+      case 0x202:
+        goto L_202;
+      case 0x204:
+        goto L_204;
+      case 0x206:
+        goto L_206;
+      case 0x208:
+        goto L_208;
+      case 0x20A:
+        goto L_20A;
+      case 0x20C:
+        goto L_20C;
+      case 0x20E:
+        goto L_20E;
+      case 0x210:
+        goto L_210;
+      case 0x212:
+        goto L_212;
+      case 0x214:
+        goto L_214;
+      case 0x216:
+        goto L_216;
+      case 0x218:
+        goto L_218;
+      case 0x21A:
+        goto L_21A;
+      case 0x21C:
+        goto L_21C;
+      case 0x21E:
+        goto L_21E;
+      case 0x220:
+        goto L_220;
+      case 0x222:
+        goto L_222;
+      case 0x224:
+        goto L_224;
+      case 0x226:
+        goto L_226;
+      case 0x228:
+        goto L_228;
+      case 0x22A:
+        goto L_22A;
+      case 0x22C:
+        goto L_22C;
+      case 0x22E:
+        goto L_22E;
+      case 0x230:
+        goto L_230;
+      case 0x232:
+        goto L_232;
+      case 0x234:
+        goto L_234;
+      case 0x236:
+        goto L_236;
+      case 0x238:
+        goto L_238;
+      case 0x23A:
+        goto L_23A;
+      case 0x23C:
+        goto L_23C;
+      case 0x23E:
+        goto L_23E;
+      case 0x240:
+        goto L_240;
+      case 0x242:
+        goto L_242;
+      case 0x244:
+        goto L_244;
+      case 0x246:
+        goto L_246;
+      case 0x248:
+        goto L_248;
+      case 0x24A:
+        goto L_24A;
+      case 0x24C:
+        goto L_24C;
+      case 0x24E:
+        goto L_24E;
+      default:
+        break;
+      }
+    }
+
+    // Hors du code traduit : interpreteur
+    {
+      uint16_t opcode = (c.readMemory(c.pc) << 8) | c.readMemory(c.pc + 1);
+      c.cycle();
+      ++executed;
+      checkStore(opcode);
+    }
+    continue;
+
+  L_200: // 00E0  CLS  [bloc]
+    STEP(0x200)
+    c.display.fill(0);
+    c.drawFlag = true;
+  L_202: // 6101  LD V1, 0x01
+    STEP(0x202)
+    c.V[0x1] = 0x01;
+  L_204: // 6008  LD V0, 0x08
+    STEP(0x204)
+    c.V[0x0] = 0x08;
+  L_206: // A250  LD I, 0x250
+    STEP(0x206)
+    c.I = 0x250;
+  L_208: // D01F  DRW V0, V1, 15
+    STEP(0x208)
+    c.executeOpcode(0xD01F);
+  L_20A: // 6010  LD V0, 0x10
+    STEP(0x20A)
+    c.V[0x0] = 0x10;
+  L_20C: // A25F  LD I, 0x25F
+    STEP(0x20C)
+    c.I = 0x25F;
+  L_20E: // D01F  DRW V0, V1, 15
+    STEP(0x20E)
+    c.executeOpcode(0xD01F);
+  L_210: // 6018  LD V0, 0x18
+    STEP(0x210)
+    c.V[0x0] = 0x18;
+  L_212: // A26E  LD I, 0x26E
+    STEP(0x212)
+    c.I = 0x26E;
+  L_214: // D01F  DRW V0, V1, 15
+    STEP(0x214)
+    c.executeOpcode(0xD01F);
+  L_216: // 6020  LD V0, 0x20
+    STEP(0x216)
+    c.V[0x0] = 0x20;
+  L_218: // A27D  LD I, 0x27D
+    STEP(0x218)
+    c.I = 0x27D;
+  L_21A: // D01F  DRW V0, V1, 15
+    STEP(0x21A)
+    c.executeOpcode(0xD01F);
+  L_21C: // 6028  LD V0, 0x28
+    STEP(0x21C)
+    c.V[0x0] = 0x28;
+  L_21E: // A28C  LD I, 0x28C
+    STEP(0x21E)
+    c.I = 0x28C;
+  L_220: // D01F  DRW V0, V1, 15
+    STEP(0x220)
+    c.executeOpcode(0xD01F);
+  L_222: // 6030  LD V0, 0x30
+    STEP(0x222)
+    c.V[0x0] = 0x30;
+  L_224: // A29B  LD I, 0x29B
+    STEP(0x224)
+    c.I = 0x29B;
+  L_226: // D01F  DRW V0, V1, 15
+    STEP(0x226)
+    c.executeOpcode(0xD01F);
+  L_228: // 6110  LD V1, 0x10
+    STEP(0x228)
+    c.V[0x1] = 0x10;
+  L_22A: // 6008  LD V0, 0x08
+    STEP(0x22A)
+    c.V[0x0] = 0x08;
+  L_22C: // A2AA  LD I, 0x2AA
+    STEP(0x22C)
+    c.I = 0x2AA;
+  L_22E: // D01F  DRW V0, V1, 15
+    STEP(0x22E)
+    c.executeOpcode(0xD01F);
+  L_230: // 6010  LD V0, 0x10
+    STEP(0x230)
+    c.V[0x0] = 0x10;
+  L_232: // A2B9  LD I, 0x2B9
+    STEP(0x232)
+    c.I = 0x2B9;
+  L_234: // D01F  DRW V0, V1, 15
+    STEP(0x234)
+    c.executeOpcode(0xD01F);
+  L_236: // 6018  LD V0, 0x18
+    STEP(0x236)
+    c.V[0x0] = 0x18;
+  L_238: // A2C8  LD I, 0x2C8
+    STEP(0x238)
+    c.I = 0x2C8;
+  L_23A: // D01F  DRW V0, V1, 15
+    STEP(0x23A)
+    c.executeOpcode(0xD01F);
+  L_23C: // 6020  LD V0, 0x20
+    STEP(0x23C)
+    c.V[0x0] = 0x20;
+  L_23E: // A2D7  LD I, 0x2D7
+    STEP(0x23E)
+    c.I = 0x2D7;
+  L_240: // D01F  DRW V0, V1, 15
+    STEP(0x240)
+    c.executeOpcode(0xD01F);
+  L_242: // 6028  LD V0, 0x28
+    STEP(0x242)
+    c.V[0x0] = 0x28;
+  L_244: // A2E6  LD I, 0x2E6
+    STEP(0x244)
+    c.I = 0x2E6;
+  L_246: // D01F  DRW V0, V1, 15
+    STEP(0x246)
+    c.executeOpcode(0xD01F);
+  L_248: // 6030  LD V0, 0x30
+    STEP(0x248)
+    c.V[0x0] = 0x30;
+  L_24A: // A2F5  LD I, 0x2F5
+    STEP(0x24A)
+    c.I = 0x2F5;
+  L_24C: // D01F  DRW V0, V1, 15
+    STEP(0x24C)
+    c.executeOpcode(0xD01F);
+  L_24E: // 124E  JP 0x24E  [bloc]
+    STEP(0x24E)
+    goto L_24E;
+  }
+
+  return executed;
+}
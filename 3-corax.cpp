@@ -0,0 +1,1962 @@
+// Genere par chip8-aot a partir de 3-corax.ch8 : ne pas modifier.
+// 761 bytes, 332 instructions traduites, 0 saut(s) indirect(s) BNNN
+
+#include "chip8_native.hpp"
+#include "latency.hpp"
+
+const uint8_t Chip8Native::ROM[] = {
+    0x12, 0x0A, 0x60, 0x01, 0x00, 0xEE, 0x60, 0x02, 0x12, 0xA6, 0x00, 0xE0,
+    0x68, 0x32, 0x6B, 0x1A, 0xA4, 0xF1, 0xD8, 0xB4, 0x68, 0x3A, 0xA4, 0xF5,
+    0xD8, 0xB4, 0x68, 0x02, 0x69, 0x06, 0x6A, 0x0B, 0x6B, 0x01, 0x65, 0x2A,
+    0x66, 0x2B, 0xA4, 0xB5, 0xD8, 0xB4, 0xA4, 0xED, 0xD9, 0xB4, 0xA4, 0xA5,
+    0x36, 0x2B, 0xA4, 0xA1, 0xDA, 0xB4, 0x6B, 0x06, 0xA4, 0xB9, 0xD8, 0xB4,
+    0xA4, 0xED, 0xD9, 0xB4, 0xA4, 0xA1, 0x45, 0x2A, 0xA4, 0xA5, 0xDA, 0xB4,
+    0x6B, 0x0B, 0xA4, 0xBD, 0xD8, 0xB4, 0xA4, 0xED, 0xD9, 0xB4, 0xA4, 0xA1,
+    0x55, 0x60, 0xA4, 0xA5, 0xDA, 0xB4, 0x6B, 0x10, 0xA4, 0xC5, 0xD8, 0xB4,
+    0xA4, 0xED, 0xD9, 0xB4, 0xA4, 0xA1, 0x76, 0xFF, 0x46, 0x2A, 0xA4, 0xA5,
+    0xDA, 0xB4, 0x7B, 0x05, 0xA4, 0xCD, 0xD8, 0xB4, 0xA4, 0xED, 0xD9, 0xB4,
+    0xA4, 0xA1, 0x95, 0x60, 0xA4, 0xA5, 0xDA, 0xB4, 0x7B, 0x05, 0xA4, 0xAD,
+    0xD8, 0xB4, 0xA4, 0xED, 0xD9, 0xB4, 0xA4, 0xA5, 0x12, 0x90, 0xA4, 0xA1,
+    0xDA, 0xB4, 0x68, 0x12, 0x69, 0x16, 0x6A, 0x1B, 0x6B, 0x01, 0xA4, 0xB1,
+    0xD8, 0xB4, 0xA4, 0xED, 0xD9, 0xB4, 0x60, 0x00, 0x22, 0x02, 0xA4, 0xA5,
+    0x40, 0x00, 0xA4, 0xA1, 0xDA, 0xB4, 0x7B, 0x05, 0xA4, 0xA9, 0xD8, 0xB4,
+    0xA4, 0xE1, 0xD9, 0xB4, 0xA4, 0xA5, 0x40, 0x02, 0xA4, 0xA1, 0x30, 0x00,
+    0xDA, 0xB4, 0x7B, 0x05, 0xA4, 0xC9, 0xD8, 0xB4, 0xA4, 0xA9, 0xD9, 0xB4,
+    0xA4, 0xA1, 0x65, 0x2A, 0x67, 0x00, 0x87, 0x50, 0x47, 0x2A, 0xA4, 0xA5,
+    0xDA, 0xB4, 0x7B, 0x05, 0xA4, 0xC9, 0xD8, 0xB4, 0xA4, 0xAD, 0xD9, 0xB4,
+    0xA4, 0xA1, 0x66, 0x0B, 0x67, 0x2A, 0x87, 0x61, 0x47, 0x2B, 0xA4, 0xA5,
+    0xDA, 0xB4, 0x7B, 0x05, 0xA4, 0xC9, 0xD8, 0xB4, 0xA4, 0xB1, 0xD9, 0xB4,
+    0xA4, 0xA1, 0x66, 0x78, 0x67, 0x1F, 0x87, 0x62, 0x47, 0x18, 0xA4, 0xA5,
+    0xDA, 0xB4, 0x7B, 0x05, 0xA4, 0xC9, 0xD8, 0xB4, 0xA4, 0xB5, 0xD9, 0xB4,
+    0xA4, 0xA1, 0x66, 0x78, 0x67, 0x1F, 0x87, 0x63, 0x47, 0x67, 0xA4, 0xA5,
+    0xDA, 0xB4, 0x68, 0x22, 0x69, 0x26, 0x6A, 0x2B, 0x6B, 0x01, 0xA4, 0xC9,
+    0xD8, 0xB4, 0xA4, 0xB9, 0xD9, 0xB4, 0xA4, 0xA1, 0x66, 0x8C, 0x67, 0x8C,
+    0x87, 0x64, 0x47, 0x18, 0xA4, 0xA5, 0xDA, 0xB4, 0x7B, 0x05, 0xA4, 0xC9,
+    0xD8, 0xB4, 0xA4, 0xBD, 0xD9, 0xB4, 0xA4, 0xA1, 0x66, 0x8C, 0x67, 0x78,
+    0x87, 0x65, 0x47, 0xEC, 0xA4, 0xA5, 0xDA, 0xB4, 0x7B, 0x05, 0xA4, 0xC9,
+    0xD8, 0xB4, 0xA4, 0xC5, 0xD9, 0xB4, 0xA4, 0xA1, 0x66, 0x78, 0x67, 0x8C,
+    0x87, 0x67, 0x47, 0xEC, 0xA4, 0xA5, 0xDA, 0xB4, 0x7B, 0x05, 0xA4, 0xC9,
+    0xD8, 0xB4, 0xA4, 0xC1, 0xD9, 0xB4, 0xA4, 0xA1, 0x66, 0x0F, 0x86, 0x66,
+    0x46, 0x07, 0xA4, 0xA5, 0xDA, 0xB4, 0x7B, 0x05, 0xA4, 0xC9, 0xD8, 0xB4,
+    0xA4, 0xE1, 0xD9, 0xB4, 0xA4, 0xA1, 0x66, 0xE0, 0x86, 0x6E, 0x46, 0xC0,
+    0xA4, 0xA5, 0xDA, 0xB4, 0x7B, 0x05, 0xA4, 0xE5, 0xD8, 0xB4, 0xA4, 0xC1,
+    0xD9, 0xB4, 0xA4, 0x9E, 0xF1, 0x65, 0xA4, 0xA5, 0x30, 0xAA, 0xA4, 0xA1,
+    0x31, 0x55, 0xA4, 0xA1, 0xDA, 0xB4, 0x68, 0x32, 0x69, 0x36, 0x6A, 0x3B,
+    0x6B, 0x01, 0xA4, 0xE5, 0xD8, 0xB4, 0xA4, 0xBD, 0xD9, 0xB4, 0xA4, 0x9E,
+    0x60, 0x00, 0x61, 0x30, 0xF1, 0x55, 0xA4, 0x9E, 0xF0, 0x65, 0x81, 0x00,
+    0xA4, 0x9F, 0xF0, 0x65, 0xA4, 0xA5, 0x30, 0x30, 0xA4, 0xA1, 0x31, 0x00,
+    0xA4, 0xA1, 0xDA, 0xB4, 0x7B, 0x05, 0xA4, 0xE5, 0xD8, 0xB4, 0xA4, 0xB5,
+    0xD9, 0xB4, 0xA4, 0x9E, 0x66, 0x89, 0xF6, 0x33, 0xF2, 0x65, 0xA4, 0xA1,
+    0x30, 0x01, 0x14, 0x32, 0x31, 0x03, 0x14, 0x32, 0x32, 0x07, 0x14, 0x32,
+    0xA4, 0x9E, 0x66, 0x41, 0xF6, 0x33, 0xF2, 0x65, 0xA4, 0xA1, 0x30, 0x00,
+    0x14, 0x32, 0x31, 0x06, 0x14, 0x32, 0x32, 0x05, 0x14, 0x32, 0xA4, 0x9E,
+    0x66, 0x04, 0xF6, 0x33, 0xF2, 0x65, 0xA4, 0xA1, 0x30, 0x00, 0x14, 0x32,
+    0x31, 0x00, 0x14, 0x32, 0x32, 0x04, 0x14, 0x32, 0xA4, 0xA5, 0xDA, 0xB4,
+    0x7B, 0x05, 0xA4, 0xE5, 0xD8, 0xB4, 0xA4, 0xE1, 0xD9, 0xB4, 0xA4, 0xA1,
+    0x66, 0x04, 0xF6, 0x1E, 0xDA, 0xB4, 0x7B, 0x05, 0xA4, 0xE9, 0xD8, 0xB4,
+    0xA4, 0xED, 0xD9, 0xB4, 0xA4, 0xA5, 0x66, 0xFF, 0x76, 0x0A, 0x36, 0x09,
+    0xA4, 0xA1, 0x86, 0x66, 0x36, 0x04, 0xA4, 0xA1, 0x66, 0xFF, 0x60, 0x0A,
+    0x86, 0x04, 0x36, 0x09, 0xA4, 0xA1, 0x86, 0x66, 0x36, 0x04, 0xA4, 0xA1,
+    0x66, 0xFF, 0x86, 0x6E, 0x86, 0x66, 0x36, 0x7F, 0xA4, 0xA1, 0x86, 0x66,
+    0x86, 0x6E, 0x36, 0x7E, 0xA4, 0xA1, 0x66, 0x05, 0x76, 0xF6, 0x36, 0xFB,
+    0xA4, 0xA1, 0x66, 0x05, 0x86, 0x05, 0x36, 0xFB, 0xA4, 0xA1, 0x66, 0x05,
+    0x80, 0x67, 0x30, 0xFB, 0xA4, 0xA1, 0xDA, 0xB4, 0x14, 0x9C, 0xAA, 0x55,
+    0x00, 0x00, 0xA0, 0x40, 0xA0, 0x00, 0xA0, 0xC0, 0x80, 0xE0, 0xA0, 0xA0,
+    0xE0, 0xC0, 0x40, 0x40, 0xE0, 0xE0, 0x20, 0xC0, 0xE0, 0xE0, 0x60, 0x20,
+    0xE0, 0xA0, 0xE0, 0x20, 0x20, 0xE0, 0xC0, 0x20, 0xC0, 0x60, 0x80, 0xE0,
+    0xE0, 0xE0, 0x20, 0x40, 0x40, 0xE0, 0xE0, 0xA0, 0xE0, 0xE0, 0xE0, 0x20,
+    0xC0, 0x40, 0xA0, 0xE0, 0xA0, 0xC0, 0xE0, 0xA0, 0xE0, 0xE0, 0x80, 0x80,
+    0xE0, 0xC0, 0xA0, 0xA0, 0xC0, 0xE0, 0xC0, 0x80, 0xE0, 0xE0, 0x80, 0xC0,
+    0x80, 0x00, 0xA0, 0xA0, 0x40, 0xA0, 0x40, 0xA0, 0xA0, 0x0A, 0xAE, 0xA2,
+    0x42, 0x38, 0x08, 0x30, 0xB8,
+};
+const size_t Chip8Native::ROM_SIZE = sizeof(Chip8Native::ROM);
+const char *const Chip8Native::ROM_NAME = "3-corax";
+
+// Adresses traduites (1 bit par adresse)
+static const uint8_t CODE_MAP[Chip8::MEMORY_SIZE / 8] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x15, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static bool isCode(unsigned addr) {
+  return addr < Chip8::MEMORY_SIZE && ((CODE_MAP[addr >> 3] >> (addr & 7)) & 1);
+}
+
+bool Chip8Native::codeIntact(unsigned first, unsigned count) const {
+  for (unsigned a = first; a < first + count && a < Chip8::MEMORY_SIZE; ++a) {
+    // Une instruction couvre les octets a et a + 1
+    bool covered = isCode(a) || (a > 0 && isCode(a - 1));
+    if (covered && chip8.memory[a] != ROM[a - Chip8::START_ADDRESS])
+      return false;
+  }
+  return true;
+}
+
+void Chip8Native::reset() {
+  valid = codeIntact(Chip8::START_ADDRESS, static_cast<unsigned>(ROM_SIZE));
+}
+
+void Chip8Native::checkStore(uint16_t opcode) {
+  unsigned count = 0;
+  if ((opcode & 0xF0FF) == 0xF033)
+    count = 3;
+  else if ((opcode & 0xF0FF) == 0xF055)
+    count = ((opcode >> 8) & 0x0F) + 1;
+
+  if (count && !codeIntact(chip8.I, count))
+    valid = false;
+}
+
+// Budget epuise : on s'arrete avant l'instruction addr
+#define STEP(addr)                                                             \
+  if (executed == budget) {                                                    \
+    c.pc = addr;                                                               \
+    return executed;                                                           \
+  }                                                                            \
+  ++executed;
+
+int Chip8Native::run(int budget) {
+  Chip8 &c = chip8;
+  int executed = 0;
+
+  while (executed < budget) {
+    if (valid) {
+      switch (c.pc) {
+      case 0x200:
+        goto L_200;
+      case 0x202:
+        goto L_202;
+      case 0x204:
+        goto L_204;
+      case 0x20A:
+        goto L_20A;
+      case 0x20C:
+        goto L_20C;
+      case 0x20E:
+        goto L_20E;
+      case 0x210:
+        goto L_210;
+      case 0x212:
+        goto L_212;
+      case 0x214:
+        goto L_214;
+      case 0x216:
+        goto L_216;
+      case 0x218:
+        goto L_218;
+      case 0x21A:
+        goto L_21A;
+      case 0x21C:
+        goto L_21C;
+      case 0x21E:
+        goto L_21E;
+      case 0x220:
+        goto L_220;
+      case 0x222:
+        goto L_222;
+      case 0x224:
+        goto L_224;
+      case 0x226:
+        goto L_226;
+      case 0x228:
+        goto L_228;
+      case 0x22A:
+        goto L_22A;
+      case 0x22C:
+        goto L_22C;
+      case 0x22E:
+        goto L_22E;
+      case 0x230:
+        goto L_230;
+      case 0x232:
+        goto L_232;
+      case 0x234:
+        goto L_234;
+      case 0x236:
+        goto L_236;
+      case 0x238:
+        goto L_238;
+      case 0x23A:
+        goto L_23A;
+      case 0x23C:
+        goto L_23C;
+      case 0x23E:
+        goto L_23E;
+      case 0x240:
+        goto L_240;
+      case 0x242:
+        goto L_242;
+      case 0x244:
+        goto L_244;
+      case 0x246:
+        goto L_246;
+      case 0x248:
+        goto L_248;
+      case 0x24A:
+        goto L_24A;
+      case 0x24C:
+        goto L_24C;
+      case 0x24E:
+        goto L_24E;
+      case 0x250:
+        goto L_250;
+      case 0x252:
+        goto L_252;
+      case 0x254:
+        goto L_254;
+      case 0x256:
+        goto L_256;
+      case 0x258:
+        goto L_258;
+      case 0x25A:
+        goto L_25A;
+      case 0x25C:
+        goto L_25C;
+      case 0x25E:
+        goto L_25E;
+      case 0x260:
+        goto L_260;
+      case 0x262:
+        goto L_262;
+      case 0x264:
+        goto L_264;
+      case 0x266:
+        goto L_266;
+      case 0x268:
+        goto L_268;
+      case 0x26A:
+        goto L_26A;
+      case 0x26C:
+        goto L_26C;
+      case 0x26E:
+        goto L_26E;
+      case 0x270:
+        goto L_270;
+      case 0x272:
+        goto L_272;
+      case 0x274:
+        goto L_274;
+      case 0x276:
+        goto L_276;
+      case 0x278:
+        goto L_278;
+      case 0x27A:
+        goto L_27A;
+      case 0x27C:
+        goto L_27C;
+      case 0x27E:
+        goto L_27E;
+      case 0x280:
+        goto L_280;
+      case 0x282:
+        goto L_282;
+      case 0x284:
+        goto L_284;
+      case 0x286:
+        goto L_286;
+      case 0x288:
+        goto L_288;
+      case 0x28A:
+        goto L_28A;
+      case 0x28C:
+        goto L_28C;
+      case 0x290:
+        goto L_290;
+      case 0x292:
+        goto L_292;
+      case 0x294:
+        goto L_294;
+      case 0x296:
+        goto L_296;
+      case 0x298:
+        goto L_298;
+      case 0x29A:
+        goto L_29A;
+      case 0x29C:
+        goto L_29C;
+      case 0x29E:
+        goto L_29E;
+      case 0x2A0:
+        goto L_2A0;
+      case 0x2A2:
+        goto L_2A2;
+      case 0x2A4:
+        goto L_2A4;
+      case 0x2A6:
+        goto L_2A6;
+      case 0x2A8:
+        goto L_2A8;
+      case 0x2AA:
+        goto L_2AA;
+      case 0x2AC:
+        goto L_2AC;
+      case 0x2AE:
+        goto L_2AE;
+      case 0x2B0:
+        goto L_2B0;
+      case 0x2B2:
+        goto L_2B2;
+      case 0x2B4:
+        goto L_2B4;
+      case 0x2B6:
+        goto L_2B6;
+      case 0x2B8:
+        goto L_2B8;
+      case 0x2BA:
+        goto L_2BA;
+      case 0x2BC:
+        goto L_2BC;
+      case 0x2BE:
+        goto L_2BE;
+      case 0x2C0:
+        goto L_2C0;
+      case 0x2C2:
+        goto L_2C2;
+      case 0x2C4:
+        goto L_2C4;
+      case 0x2C6:
+        goto L_2C6;
+      case 0x2C8:
+        goto L_2C8;
+      case 0x2CA:
+        goto L_2CA;
+      case 0x2CC:
+        goto L_2CC;
+      case 0x2CE:
+        goto L_2CE;
+      case 0x2D0:
+        goto L_2D0;
+      case 0x2D2:
+        goto L_2D2;
+      case 0x2D4:
+        goto L_2D4;
+      case 0x2D6:
+        goto L_2D6;
+      case 0x2D8:
+        goto L_2D8;
+      case 0x2DA:
+        goto L_2DA;
+      case 0x2DC:
+        goto L_2DC;
+      case 0x2DE:
+        goto L_2DE;
+      case 0x2E0:
+        goto L_2E0;
+      case 0x2E2:
+        goto L_2E2;
+      case 0x2E4:
+        goto L_2E4;
+      case 0x2E6:
+        goto L_2E6;
+      case 0x2E8:
+        goto L_2E8;
+      case 0x2EA:
+        goto L_2EA;
+      case 0x2EC:
+        goto L_2EC;
+      case 0x2EE:
+        goto L_2EE;
+      case 0x2F0:
+        goto L_2F0;
+      case 0x2F2:
+        goto L_2F2;
+      case 0x2F4:
+        goto L_2F4;
+      case 0x2F6:
+        goto L_2F6;
+      case 0x2F8:
+        goto L_2F8;
+      case 0x2FA:
+        goto L_2FA;
+      case 0x2FC:
+        goto L_2FC;
+      case 0x2FE:
+        goto L_2FE;
+      case 0x300:
+        goto L_300;
+      case 0x302:
+        goto L_302;
+      case 0x304:
+        goto L_304;
+      case 0x306:
+        goto L_306;
+      case 0x308:
+        goto L_308;
+      case 0x30A:
+        goto L_30A;
+      case 0x30C:
+        goto L_30C;
+      case 0x30E:
+        goto L_30E;
+      case 0x310:
+        goto L_310;
+      case 0x312:
+        goto L_312;
+      case 0x314:
+        goto L_314;
+      case 0x316:
+        goto L_316;
+      case 0x318:
+        goto L_318;
+      case 0x31A:
+        goto L_31A;
+      case 0x31C:
+        goto L_31C;
+      case 0x31E:
+        goto L_31E;
+      case 0x320:
+        goto L_320;
+      case 0x322:
+        goto L_322;
+      case 0x324:
+        goto L_324;
+      case 0x326:
+        goto L_326;
+      case 0x328:
+        goto L_328;
+      case 0x32A:
+        goto L_32A;
+      case 0x32C:
+        goto L_32C;
+      case 0x32E:
+        goto L_32E;
+      case 0x330:
+        goto L_330;
+      case 0x332:
+        goto L_332;
+      case 0x334:
+        goto L_334;
+      case 0x336:
+        goto L_336;
+      case 0x338:
+        goto L_338;
+      case 0x33A:
+        goto L_33A;
+      case 0x33C:
+        goto L_33C;
+      case 0x33E:
+        goto L_33E;
+      case 0x340:
+        goto L_340;
+      case 0x342:
+        goto L_342;
+      case 0x344:
+        goto L_344;
+      case 0x346:
+        goto L_346;
+      case 0x348:
+        goto L_348;
+      case 0x34A:
+        goto L_34A;
+      case 0x34C:
+        goto L_34C;
+      case 0x34E:
+        goto L_34E;
+      case 0x350:
+        goto L_350;
+      case 0x352:
+        goto L_352;
+      case 0x354:
+        goto L_354;
+      case 0x356:
+        goto L_356;
+      case 0x358:
+        goto L_358;
+      case 0x35A:
+        goto L_35A;
+      case 0x35C:
+        goto L_35C;
+      case 0x35E:
+        goto L_35E;
+      case 0x360:
+        goto L_360;
+      case 0x362:
+        goto L_362;
+      case 0x364:
+        goto L_364;
+      case 0x366:
+        goto L_366;
+      case 0x368:
+        goto L_368;
+      case 0x36A:
+        goto L_36A;
+      case 0x36C:
+        goto L_36C;
+      case 0x36E:
+        goto L_36E;
+      case 0x370:
+        goto L_370;
+      case 0x372:
+        goto L_372;
+      case 0x374:
+        goto L_374;
+      case 0x376:
+        goto L_376;
+      case 0x378:
+        goto L_378;
+      case 0x37A:
+        goto L_37A;
+      case 0x37C:
+        goto L_37C;
+      case 0x37E:
+        goto L_37E;
+      case 0x380:
+        goto L_380;
+      case 0x382:
+        goto L_382;
+      case 0x384:
+        goto L_384;
+      case 0x386:
+        goto L_386;
+      case 0x388:
+        goto L_388;
+      case 0x38A:
+        goto L_38A;
+      case 0x38C:
+        goto L_38C;
+      case 0x38E:
+        goto L_38E;
+      case 0x390:
+        goto L_390;
+      case 0x392:
+        goto L_392;
+      case 0x394:
+        goto L_394;
+      case 0x396:
+        goto L_396;
+      case 0x398:
+        goto L_398;
+      case 0x39A:
+        goto L_39A;
+      case 0x39C:
+        goto L_39C;
+      case 0x39E:
+        goto L_39E;
+      case 0x3A0:
+        goto L_3A0;
+      case 0x3A2:
+        goto L_3A2;
+      case 0x3A4:
+        goto L_3A4;
+      case 0x3A6:
+        goto L_3A6;
+      case 0x3A8:
+        goto L_3A8;
+      case 0x3AA:
+        goto L_3AA;
+      case 0x3AC:
+        goto L_3AC;
+      case 0x3AE:
+        goto L_3AE;
+      case 0x3B0:
+        goto L_3B0;
+      case 0x3B2:
+        goto L_3B2;
+      case 0x3B4:
+        goto L_3B4;
+      case 0x3B6:
+        goto L_3B6;
+      case 0x3B8:
+        goto L_3B8;
+      case 0x3BA:
+        goto L_3BA;
+      case 0x3BC:
+        goto L_3BC;
+      case 0x3BE:
+        goto L_3BE;
+      case 0x3C0:
+        goto L_3C0;
+      case 0x3C2:
+        goto L_3C2;
+      case 0x3C4:
+        goto L_3C4;
+      case 0x3C6:
+        goto L_3C6;
+      case 0x3C8:
+        goto L_3C8;
+      case 0x3CA:
+        goto L_3CA;
+      case 0x3CC:
+        goto L_3CC;
+      case 0x3CE:
+        goto L_3CE;
+      case 0x3D0:
+        goto L_3D0;
+      case 0x3D2:
+        goto L_3D2;
+      case 0x3D4:
+        goto L_3D4;
+      case 0x3D6:
+        goto L_3D6;
+      case 0x3D8:
+        goto L_3D8;
+      case 0x3DA:
+        goto L_3DA;
+      case 0x3DC:
+        goto L_3DC;
+      case 0x3DE:
+        goto L_3DE;
+      case 0x3E0:
+        goto L_3E0;
+      case 0x3E2:
+        goto L_3E2;
+      case 0x3E4:
+        goto L_3E4;
+      case 0x3E6:
+        goto L_3E6;
+      case 0x3E8:
+        goto L_3E8;
+      case 0x3EA:
+        goto L_3EA;
+      case 0x3EC:
+        goto L_3EC;
+      case 0x3EE:
+        goto L_3EE;
+      case 0x3F0:
+        goto L_3F0;
+      case 0x3F2:
+        goto L_3F2;
+      case 0x3F4:
+        goto L_3F4;
+      case 0x3F6:
+        goto L_3F6;
+      case 0x3F8:
+        goto L_3F8;
+      case 0x3FA:
+        goto L_3FA;
+      case 0x3FC:
+        goto L_3FC;
+      case 0x3FE:
+        goto L_3FE;
+      case 0x400:
+        goto L_400;
+      case 0x402:
+        goto L_402;
+      case 0x404:
+        goto L_404;
+      case 0x406:
+        goto L_406;
+      case 0x408:
+        goto L_408;
+      case 0x40A:
+        goto L_40A;
+      case 0x40C:
+        goto L_40C;
+      case 0x40E:
+        goto L_40E;
+      case 0x410:
+        goto L_410;
+      case 0x412:
+        goto L_412;
+      case 0x414:
+        goto L_414;
+      case 0x416:
+        goto L_416;
+      case 0x418:
+        goto L_418;
+      case 0x41A:
+        goto L_41A;
+      case 0x41C:
+        goto L_41C;
+      case 0x41E:
+        goto L_41E;
+      case 0x420:
+        goto L_420;
+      case 0x422:
+        goto L_422;
+      case 0x424:
+        goto L_424;
+      case 0x426:
+        goto L_426;
+      case 0x428:
+        goto L_428;
+      case 0x42A:
+        goto L_42A;
+      case 0x42C:
+        goto L_42C;
+      case 0x42E:
+        goto L_42E;
+      case 0x430:
+        goto L_430;
+      case 0x432:
+        goto L_432;
+      case 0x434:
+        goto L_434;
+      case 0x436:
+        goto L_436;
+      case 0x438:
+        goto L_438;
+      case 0x43A:
+        goto L_43A;
+      case 0x43C:
+        goto L_43C;
+      case 0x43E:
+        goto L_43E;
+      case 0x440:
+        goto L_440;
+      case 0x442:
+        goto L_442;
+      case 0x444:
+        goto L_444;
+      case 0x446:
+        goto L_446;
+      case 0x448:
+        goto L_448;
+      case 0x44A:
+        goto L_44A;
+      case 0x44C:
+        goto L_44C;
+      case 0x44E:
+        goto L_44E;
+      case 0x450:
+        goto L_450;
+      case 0x452:
+        goto L_452;
+      case 0x454:
+        goto L_454;
+      case 0x456:
+        goto L_456;
+      case 0x458:
+        goto L_458;
+      case 0x45A:
+        goto L_45A;
+      case 0x45C:
+        goto L_45C;
+      case 0x45E:
+        goto L_45E;
+      case 0x460:
+        goto L_460;
+      case 0x462:
+        goto L_462;
+      case 0x464:
+        goto L_464;
+      case 0x466:
+        goto L_466;
+      case 0x468:
+        goto L_468;
+      case 0x46A:
+        goto L_46A;
+      case 0x46C:
+        goto L_46C;
+      case 0x46E:
+        goto L_46E;
+      case 0x470:
+        goto L_470;
+      case 0x472:
+        goto L_472;
+      case 0x474:
+        goto L_474;
+      case 0x476:
+        goto L_476;
+      case 0x478:
+        goto L_478;
+      case 0x47A:
+        goto L_47A;
+      case 0x47C:
+        goto L_47C;
+      case 0x47E:
+        goto L_47E;
+      case 0x480:
+        goto L_480;
+      case 0x482:
+        goto L_482;
+      case 0x484:
+        goto L_484;
+      case 0x486:
+        goto L_486;
+      case 0x488:
+        goto L_488;
+      case 0x48A:
+        goto L_48A;
+      case 0x48C:
+        goto L_48C;
+      case 0x48E:
+        goto L_48E;
+      case 0x490:
+        goto L_490;
+      case 0x492:
+        goto L_492;
+      case 0x494:
+        goto L_494;
+      case 0x496:
+        goto L_496;
+      case 0x498:
+        goto L_498;
+      case 0x49A:
+        goto L_49A;
+      case 0x49C:
+        goto L_49C;
+      default:
+        break;
+      }
+    }
+
+    // Hors du code traduit : interpreteur
+    {
+      uint16_t opcode = (c.readMemory(c.pc) << 8) | c.readMemory(c.pc + 1);
+      c.cycle();
+      ++executed;
+      checkStore(opcode);
+    }
+    continue;
+
+  L_200: // 120A  JP 0x20A  [bloc]
+    STEP(0x200)
+    goto L_20A;
+  L_202: // 6001  LD V0, 0x01  [bloc]
+    STEP(0x202)
+    c.V[0x0] = 0x01;
+  L_204: // 00EE  RET
+    STEP(0x204)
+    --c.sp;
+    c.pc = c.stack[c.sp];
+    continue;
+  L_20A: // 00E0  CLS  [bloc]
+    STEP(0x20A)
+    c.display.fill(0);
+    c.drawFlag = true;
+  L_20C: // 6832  LD V8, 0x32
+    STEP(0x20C)
+    c.V[0x8] = 0x32;
+  L_20E: // 6B1A  LD VB, 0x1A
+    STEP(0x20E)
+    c.V[0xB] = 0x1A;
+  L_210: // A4F1  LD I, 0x4F1
+    STEP(0x210)
+    c.I = 0x4F1;
+  L_212: // D8B4  DRW V8, VB, 4
+    STEP(0x212)
+    c.executeOpcode(0xD8B4);
+  L_214: // 683A  LD V8, 0x3A
+    STEP(0x214)
+    c.V[0x8] = 0x3A;
+  L_216: // A4F5  LD I, 0x4F5
+    STEP(0x216)
+    c.I = 0x4F5;
+  L_218: // D8B4  DRW V8, VB, 4
+    STEP(0x218)
+    c.executeOpcode(0xD8B4);
+  L_21A: // 6802  LD V8, 0x02
+    STEP(0x21A)
+    c.V[0x8] = 0x02;
+  L_21C: // 6906  LD V9, 0x06
+    STEP(0x21C)
+    c.V[0x9] = 0x06;
+  L_21E: // 6A0B  LD VA, 0x0B
+    STEP(0x21E)
+    c.V[0xA] = 0x0B;
+  L_220: // 6B01  LD VB, 0x01
+    STEP(0x220)
+    c.V[0xB] = 0x01;
+  L_222: // 652A  LD V5, 0x2A
+    STEP(0x222)
+    c.V[0x5] = 0x2A;
+  L_224: // 662B  LD V6, 0x2B
+    STEP(0x224)
+    c.V[0x6] = 0x2B;
+  L_226: // A4B5  LD I, 0x4B5
+    STEP(0x226)
+    c.I = 0x4B5;
+  L_228: // D8B4  DRW V8, VB, 4
+    STEP(0x228)
+    c.executeOpcode(0xD8B4);
+  L_22A: // A4ED  LD I, 0x4ED
+    STEP(0x22A)
+    c.I = 0x4ED;
+  L_22C: // D9B4  DRW V9, VB, 4
+    STEP(0x22C)
+    c.executeOpcode(0xD9B4);
+  L_22E: // A4A5  LD I, 0x4A5
+    STEP(0x22E)
+    c.I = 0x4A5;
+  L_230: // 362B  SE V6, 0x2B
+    STEP(0x230)
+    if (c.V[0x6] == 0x2B)
+      goto L_234;
+  L_232: // A4A1  LD I, 0x4A1  [bloc]
+    STEP(0x232)
+    c.I = 0x4A1;
+  L_234: // DAB4  DRW VA, VB, 4  [bloc]
+    STEP(0x234)
+    c.executeOpcode(0xDAB4);
+  L_236: // 6B06  LD VB, 0x06
+    STEP(0x236)
+    c.V[0xB] = 0x06;
+  L_238: // A4B9  LD I, 0x4B9
+    STEP(0x238)
+    c.I = 0x4B9;
+  L_23A: // D8B4  DRW V8, VB, 4
+    STEP(0x23A)
+    c.executeOpcode(0xD8B4);
+  L_23C: // A4ED  LD I, 0x4ED
+    STEP(0x23C)
+    c.I = 0x4ED;
+  L_23E: // D9B4  DRW V9, VB, 4
+    STEP(0x23E)
+    c.executeOpcode(0xD9B4);
+  L_240: // A4A1  LD I, 0x4A1
+    STEP(0x240)
+    c.I = 0x4A1;
+  L_242: // 452A  SNE V5, 0x2A
+    STEP(0x242)
+    if (c.V[0x5] != 0x2A)
+      goto L_246;
+  L_244: // A4A5  LD I, 0x4A5  [bloc]
+    STEP(0x244)
+    c.I = 0x4A5;
+  L_246: // DAB4  DRW VA, VB, 4  [bloc]
+    STEP(0x246)
+    c.executeOpcode(0xDAB4);
+  L_248: // 6B0B  LD VB, 0x0B
+    STEP(0x248)
+    c.V[0xB] = 0x0B;
+  L_24A: // A4BD  LD I, 0x4BD
+    STEP(0x24A)
+    c.I = 0x4BD;
+  L_24C: // D8B4  DRW V8, VB, 4
+    STEP(0x24C)
+    c.executeOpcode(0xD8B4);
+  L_24E: // A4ED  LD I, 0x4ED
+    STEP(0x24E)
+    c.I = 0x4ED;
+  L_250: // D9B4  DRW V9, VB, 4
+    STEP(0x250)
+    c.executeOpcode(0xD9B4);
+  L_252: // A4A1  LD I, 0x4A1
+    STEP(0x252)
+    c.I = 0x4A1;
+  L_254: // 5560  SE V5, V6
+    STEP(0x254)
+    if (c.V[0x5] == c.V[0x6])
+      goto L_258;
+  L_256: // A4A5  LD I, 0x4A5  [bloc]
+    STEP(0x256)
+    c.I = 0x4A5;
+  L_258: // DAB4  DRW VA, VB, 4  [bloc]
+    STEP(0x258)
+    c.executeOpcode(0xDAB4);
+  L_25A: // 6B10  LD VB, 0x10
+    STEP(0x25A)
+    c.V[0xB] = 0x10;
+  L_25C: // A4C5  LD I, 0x4C5
+    STEP(0x25C)
+    c.I = 0x4C5;
+  L_25E: // D8B4  DRW V8, VB, 4
+    STEP(0x25E)
+    c.executeOpcode(0xD8B4);
+  L_260: // A4ED  LD I, 0x4ED
+    STEP(0x260)
+    c.I = 0x4ED;
+  L_262: // D9B4  DRW V9, VB, 4
+    STEP(0x262)
+    c.executeOpcode(0xD9B4);
+  L_264: // A4A1  LD I, 0x4A1
+    STEP(0x264)
+    c.I = 0x4A1;
+  L_266: // 76FF  ADD V6, 0xFF
+    STEP(0x266)
+    c.V[0x6] += 0xFF;
+  L_268: // 462A  SNE V6, 0x2A
+    STEP(0x268)
+    if (c.V[0x6] != 0x2A)
+      goto L_26C;
+  L_26A: // A4A5  LD I, 0x4A5  [bloc]
+    STEP(0x26A)
+    c.I = 0x4A5;
+  L_26C: // DAB4  DRW VA, VB, 4  [bloc]
+    STEP(0x26C)
+    c.executeOpcode(0xDAB4);
+  L_26E: // 7B05  ADD VB, 0x05
+    STEP(0x26E)
+    c.V[0xB] += 0x05;
+  L_270: // A4CD  LD I, 0x4CD
+    STEP(0x270)
+    c.I = 0x4CD;
+  L_272: // D8B4  DRW V8, VB, 4
+    STEP(0x272)
+    c.executeOpcode(0xD8B4);
+  L_274: // A4ED  LD I, 0x4ED
+    STEP(0x274)
+    c.I = 0x4ED;
+  L_276: // D9B4  DRW V9, VB, 4
+    STEP(0x276)
+    c.executeOpcode(0xD9B4);
+  L_278: // A4A1  LD I, 0x4A1
+    STEP(0x278)
+    c.I = 0x4A1;
+  L_27A: // 9560  SNE V5, V6
+    STEP(0x27A)
+    if (c.V[0x5] != c.V[0x6])
+      goto L_27E;
+  L_27C: // A4A5  LD I, 0x4A5  [bloc]
+    STEP(0x27C)
+    c.I = 0x4A5;
+  L_27E: // DAB4  DRW VA, VB, 4  [bloc]
+    STEP(0x27E)
+    c.executeOpcode(0xDAB4);
+  L_280: // 7B05  ADD VB, 0x05
+    STEP(0x280)
+    c.V[0xB] += 0x05;
+  L_282: // A4AD  LD I, 0x4AD
+    STEP(0x282)
+    c.I = 0x4AD;
+  L_284: // D8B4  DRW V8, VB, 4
+    STEP(0x284)
+    c.executeOpcode(0xD8B4);
+  L_286: // A4ED  LD I, 0x4ED
+    STEP(0x286)
+    c.I = 0x4ED;
+  L_288: // D9B4  DRW V9, VB, 4
+    STEP(0x288)
+    c.executeOpcode(0xD9B4);
+  L_28A: // A4A5  LD I, 0x4A5
+    STEP(0x28A)
+    c.I = 0x4A5;
+  L_28C: // 1290  JP 0x290
+    STEP(0x28C)
+    goto L_290;
+  L_290: // DAB4  DRW VA, VB, 4  [bloc]
+    STEP(0x290)
+    c.executeOpcode(0xDAB4);
+  L_292: // 6812  LD V8, 0x12
+    STEP(0x292)
+    c.V[0x8] = 0x12;
+  L_294: // 6916  LD V9, 0x16
+    STEP(0x294)
+    c.V[0x9] = 0x16;
+  L_296: // 6A1B  LD VA, 0x1B
+    STEP(0x296)
+    c.V[0xA] = 0x1B;
+  L_298: // 6B01  LD VB, 0x01
+    STEP(0x298)
+    c.V[0xB] = 0x01;
+  L_29A: // A4B1  LD I, 0x4B1
+    STEP(0x29A)
+    c.I = 0x4B1;
+  L_29C: // D8B4  DRW V8, VB, 4
+    STEP(0x29C)
+    c.executeOpcode(0xD8B4);
+  L_29E: // A4ED  LD I, 0x4ED
+    STEP(0x29E)
+    c.I = 0x4ED;
+  L_2A0: // D9B4  DRW V9, VB, 4
+    STEP(0x2A0)
+    c.executeOpcode(0xD9B4);
+  L_2A2: // 6000  LD V0, 0x00
+    STEP(0x2A2)
+    c.V[0x0] = 0x00;
+  L_2A4: // 2202  CALL 0x202
+    STEP(0x2A4)
+    c.stack[c.sp] = 0x2A6;
+    ++c.sp;
+    goto L_202;
+  L_2A6: // A4A5  LD I, 0x4A5  [bloc]
+    STEP(0x2A6)
+    c.I = 0x4A5;
+  L_2A8: // 4000  SNE V0, 0x00
+    STEP(0x2A8)
+    if (c.V[0x0] != 0x00)
+      goto L_2AC;
+  L_2AA: // A4A1  LD I, 0x4A1  [bloc]
+    STEP(0x2AA)
+    c.I = 0x4A1;
+  L_2AC: // DAB4  DRW VA, VB, 4  [bloc]
+    STEP(0x2AC)
+    c.executeOpcode(0xDAB4);
+  L_2AE: // 7B05  ADD VB, 0x05
+    STEP(0x2AE)
+    c.V[0xB] += 0x05;
+  L_2B0: // A4A9  LD I, 0x4A9
+    STEP(0x2B0)
+    c.I = 0x4A9;
+  L_2B2: // D8B4  DRW V8, VB, 4
+    STEP(0x2B2)
+    c.executeOpcode(0xD8B4);
+  L_2B4: // A4E1  LD I, 0x4E1
+    STEP(0x2B4)
+    c.I = 0x4E1;
+  L_2B6: // D9B4  DRW V9, VB, 4
+    STEP(0x2B6)
+    c.executeOpcode(0xD9B4);
+  L_2B8: // A4A5  LD I, 0x4A5
+    STEP(0x2B8)
+    c.I = 0x4A5;
+  L_2BA: // 4002  SNE V0, 0x02
+    STEP(0x2BA)
+    if (c.V[0x0] != 0x02)
+      goto L_2BE;
+  L_2BC: // A4A1  LD I, 0x4A1  [bloc]
+    STEP(0x2BC)
+    c.I = 0x4A1;
+  L_2BE: // 3000  SE V0, 0x00  [bloc]
+    STEP(0x2BE)
+    if (c.V[0x0] == 0x00)
+      goto L_2C2;
+  L_2C0: // DAB4  DRW VA, VB, 4  [bloc]
+    STEP(0x2C0)
+    c.executeOpcode(0xDAB4);
+  L_2C2: // 7B05  ADD VB, 0x05  [bloc]
+    STEP(0x2C2)
+    c.V[0xB] += 0x05;
+  L_2C4: // A4C9  LD I, 0x4C9
+    STEP(0x2C4)
+    c.I = 0x4C9;
+  L_2C6: // D8B4  DRW V8, VB, 4
+    STEP(0x2C6)
+    c.executeOpcode(0xD8B4);
+  L_2C8: // A4A9  LD I, 0x4A9
+    STEP(0x2C8)
+    c.I = 0x4A9;
+  L_2CA: // D9B4  DRW V9, VB, 4
+    STEP(0x2CA)
+    c.executeOpcode(0xD9B4);
+  L_2CC: // A4A1  LD I, 0x4A1
+    STEP(0x2CC)
+    c.I = 0x4A1;
+  L_2CE: // 652A  LD V5, 0x2A
+    STEP(0x2CE)
+    c.V[0x5] = 0x2A;
+  L_2D0: // 6700  LD V7, 0x00
+    STEP(0x2D0)
+    c.V[0x7] = 0x00;
+  L_2D2: // 8750  LD V7, V5
+    STEP(0x2D2)
+    c.V[0x7] = c.V[0x5];
+  L_2D4: // 472A  SNE V7, 0x2A
+    STEP(0x2D4)
+    if (c.V[0x7] != 0x2A)
+      goto L_2D8;
+  L_2D6: // A4A5  LD I, 0x4A5  [bloc]
+    STEP(0x2D6)
+    c.I = 0x4A5;
+  L_2D8: // DAB4  DRW VA, VB, 4  [bloc]
+    STEP(0x2D8)
+    c.executeOpcode(0xDAB4);
+  L_2DA: // 7B05  ADD VB, 0x05
+    STEP(0x2DA)
+    c.V[0xB] += 0x05;
+  L_2DC: // A4C9  LD I, 0x4C9
+    STEP(0x2DC)
+    c.I = 0x4C9;
+  L_2DE: // D8B4  DRW V8, VB, 4
+    STEP(0x2DE)
+    c.executeOpcode(0xD8B4);
+  L_2E0: // A4AD  LD I, 0x4AD
+    STEP(0x2E0)
+    c.I = 0x4AD;
+  L_2E2: // D9B4  DRW V9, VB, 4
+    STEP(0x2E2)
+    c.executeOpcode(0xD9B4);
+  L_2E4: // A4A1  LD I, 0x4A1
+    STEP(0x2E4)
+    c.I = 0x4A1;
+  L_2E6: // 660B  LD V6, 0x0B
+    STEP(0x2E6)
+    c.V[0x6] = 0x0B;
+  L_2E8: // 672A  LD V7, 0x2A
+    STEP(0x2E8)
+    c.V[0x7] = 0x2A;
+  L_2EA: // 8761  OR V7, V6
+    STEP(0x2EA)
+    c.V[0x7] |= c.V[0x6];
+    if (c.quirks.vfReset)
+      c.V[0xF] = 0;
+  L_2EC: // 472B  SNE V7, 0x2B
+    STEP(0x2EC)
+    if (c.V[0x7] != 0x2B)
+      goto L_2F0;
+  L_2EE: // A4A5  LD I, 0x4A5  [bloc]
+    STEP(0x2EE)
+    c.I = 0x4A5;
+  L_2F0: // DAB4  DRW VA, VB, 4  [bloc]
+    STEP(0x2F0)
+    c.executeOpcode(0xDAB4);
+  L_2F2: // 7B05  ADD VB, 0x05
+    STEP(0x2F2)
+    c.V[0xB] += 0x05;
+  L_2F4: // A4C9  LD I, 0x4C9
+    STEP(0x2F4)
+    c.I = 0x4C9;
+  L_2F6: // D8B4  DRW V8, VB, 4
+    STEP(0x2F6)
+    c.executeOpcode(0xD8B4);
+  L_2F8: // A4B1  LD I, 0x4B1
+    STEP(0x2F8)
+    c.I = 0x4B1;
+  L_2FA: // D9B4  DRW V9, VB, 4
+    STEP(0x2FA)
+    c.executeOpcode(0xD9B4);
+  L_2FC: // A4A1  LD I, 0x4A1
+    STEP(0x2FC)
+    c.I = 0x4A1;
+  L_2FE: // 6678  LD V6, 0x78
+    STEP(0x2FE)
+    c.V[0x6] = 0x78;
+  L_300: // 671F  LD V7, 0x1F
+    STEP(0x300)
+    c.V[0x7] = 0x1F;
+  L_302: // 8762  AND V7, V6
+    STEP(0x302)
+    c.V[0x7] &= c.V[0x6];
+    if (c.quirks.vfReset)
+      c.V[0xF] = 0;
+  L_304: // 4718  SNE V7, 0x18
+    STEP(0x304)
+    if (c.V[0x7] != 0x18)
+      goto L_308;
+  L_306: // A4A5  LD I, 0x4A5  [bloc]
+    STEP(0x306)
+    c.I = 0x4A5;
+  L_308: // DAB4  DRW VA, VB, 4  [bloc]
+    STEP(0x308)
+    c.executeOpcode(0xDAB4);
+  L_30A: // 7B05  ADD VB, 0x05
+    STEP(0x30A)
+    c.V[0xB] += 0x05;
+  L_30C: // A4C9  LD I, 0x4C9
+    STEP(0x30C)
+    c.I = 0x4C9;
+  L_30E: // D8B4  DRW V8, VB, 4
+    STEP(0x30E)
+    c.executeOpcode(0xD8B4);
+  L_310: // A4B5  LD I, 0x4B5
+    STEP(0x310)
+    c.I = 0x4B5;
+  L_312: // D9B4  DRW V9, VB, 4
+    STEP(0x312)
+    c.executeOpcode(0xD9B4);
+  L_314: // A4A1  LD I, 0x4A1
+    STEP(0x314)
+    c.I = 0x4A1;
+  L_316: // 6678  LD V6, 0x78
+    STEP(0x316)
+    c.V[0x6] = 0x78;
+  L_318: // 671F  LD V7, 0x1F
+    STEP(0x318)
+    c.V[0x7] = 0x1F;
+  L_31A: // 8763  XOR V7, V6
+    STEP(0x31A)
+    c.V[0x7] ^= c.V[0x6];
+    if (c.quirks.vfReset)
+      c.V[0xF] = 0;
+  L_31C: // 4767  SNE V7, 0x67
+    STEP(0x31C)
+    if (c.V[0x7] != 0x67)
+      goto L_320;
+  L_31E: // A4A5  LD I, 0x4A5  [bloc]
+    STEP(0x31E)
+    c.I = 0x4A5;
+  L_320: // DAB4  DRW VA, VB, 4  [bloc]
+    STEP(0x320)
+    c.executeOpcode(0xDAB4);
+  L_322: // 6822  LD V8, 0x22
+    STEP(0x322)
+    c.V[0x8] = 0x22;
+  L_324: // 6926  LD V9, 0x26
+    STEP(0x324)
+    c.V[0x9] = 0x26;
+  L_326: // 6A2B  LD VA, 0x2B
+    STEP(0x326)
+    c.V[0xA] = 0x2B;
+  L_328: // 6B01  LD VB, 0x01
+    STEP(0x328)
+    c.V[0xB] = 0x01;
+  L_32A: // A4C9  LD I, 0x4C9
+    STEP(0x32A)
+    c.I = 0x4C9;
+  L_32C: // D8B4  DRW V8, VB, 4
+    STEP(0x32C)
+    c.executeOpcode(0xD8B4);
+  L_32E: // A4B9  LD I, 0x4B9
+    STEP(0x32E)
+    c.I = 0x4B9;
+  L_330: // D9B4  DRW V9, VB, 4
+    STEP(0x330)
+    c.executeOpcode(0xD9B4);
+  L_332: // A4A1  LD I, 0x4A1
+    STEP(0x332)
+    c.I = 0x4A1;
+  L_334: // 668C  LD V6, 0x8C
+    STEP(0x334)
+    c.V[0x6] = 0x8C;
+  L_336: // 678C  LD V7, 0x8C
+    STEP(0x336)
+    c.V[0x7] = 0x8C;
+  L_338: // 8764  ADD V7, V6
+    STEP(0x338)
+    {
+      uint16_t sum = c.V[0x7] + c.V[0x6];
+      c.V[0xF] = (sum > 255) ? 1 : 0;
+      c.V[0x7] = sum & 0xFF;
+    }
+  L_33A: // 4718  SNE V7, 0x18
+    STEP(0x33A)
+    if (c.V[0x7] != 0x18)
+      goto L_33E;
+  L_33C: // A4A5  LD I, 0x4A5  [bloc]
+    STEP(0x33C)
+    c.I = 0x4A5;
+  L_33E: // DAB4  DRW VA, VB, 4  [bloc]
+    STEP(0x33E)
+    c.executeOpcode(0xDAB4);
+  L_340: // 7B05  ADD VB, 0x05
+    STEP(0x340)
+    c.V[0xB] += 0x05;
+  L_342: // A4C9  LD I, 0x4C9
+    STEP(0x342)
+    c.I = 0x4C9;
+  L_344: // D8B4  DRW V8, VB, 4
+    STEP(0x344)
+    c.executeOpcode(0xD8B4);
+  L_346: // A4BD  LD I, 0x4BD
+    STEP(0x346)
+    c.I = 0x4BD;
+  L_348: // D9B4  DRW V9, VB, 4
+    STEP(0x348)
+    c.executeOpcode(0xD9B4);
+  L_34A: // A4A1  LD I, 0x4A1
+    STEP(0x34A)
+    c.I = 0x4A1;
+  L_34C: // 668C  LD V6, 0x8C
+    STEP(0x34C)
+    c.V[0x6] = 0x8C;
+  L_34E: // 6778  LD V7, 0x78
+    STEP(0x34E)
+    c.V[0x7] = 0x78;
+  L_350: // 8765  SUB V7, V6
+    STEP(0x350)
+    c.V[0xF] = (c.V[0x7] > c.V[0x6]) ? 1 : 0;
+    c.V[0x7] -= c.V[0x6];
+  L_352: // 47EC  SNE V7, 0xEC
+    STEP(0x352)
+    if (c.V[0x7] != 0xEC)
+      goto L_356;
+  L_354: // A4A5  LD I, 0x4A5  [bloc]
+    STEP(0x354)
+    c.I = 0x4A5;
+  L_356: // DAB4  DRW VA, VB, 4  [bloc]
+    STEP(0x356)
+    c.executeOpcode(0xDAB4);
+  L_358: // 7B05  ADD VB, 0x05
+    STEP(0x358)
+    c.V[0xB] += 0x05;
+  L_35A: // A4C9  LD I, 0x4C9
+    STEP(0x35A)
+    c.I = 0x4C9;
+  L_35C: // D8B4  DRW V8, VB, 4
+    STEP(0x35C)
+    c.executeOpcode(0xD8B4);
+  L_35E: // A4C5  LD I, 0x4C5
+    STEP(0x35E)
+    c.I = 0x4C5;
+  L_360: // D9B4  DRW V9, VB, 4
+    STEP(0x360)
+    c.executeOpcode(0xD9B4);
+  L_362: // A4A1  LD I, 0x4A1
+    STEP(0x362)
+    c.I = 0x4A1;
+  L_364: // 6678  LD V6, 0x78
+    STEP(0x364)
+    c.V[0x6] = 0x78;
+  L_366: // 678C  LD V7, 0x8C
+    STEP(0x366)
+    c.V[0x7] = 0x8C;
+  L_368: // 8767  SUBN V7, V6
+    STEP(0x368)
+    c.V[0xF] = (c.V[0x6] > c.V[0x7]) ? 1 : 0;
+    c.V[0x7] = c.V[0x6] - c.V[0x7];
+  L_36A: // 47EC  SNE V7, 0xEC
+    STEP(0x36A)
+    if (c.V[0x7] != 0xEC)
+      goto L_36E;
+  L_36C: // A4A5  LD I, 0x4A5  [bloc]
+    STEP(0x36C)
+    c.I = 0x4A5;
+  L_36E: // DAB4  DRW VA, VB, 4  [bloc]
+    STEP(0x36E)
+    c.executeOpcode(0xDAB4);
+  L_370: // 7B05  ADD VB, 0x05
+    STEP(0x370)
+    c.V[0xB] += 0x05;
+  L_372: // A4C9  LD I, 0x4C9
+    STEP(0x372)
+    c.I = 0x4C9;
+  L_374: // D8B4  DRW V8, VB, 4
+    STEP(0x374)
+    c.executeOpcode(0xD8B4);
+  L_376: // A4C1  LD I, 0x4C1
+    STEP(0x376)
+    c.I = 0x4C1;
+  L_378: // D9B4  DRW V9, VB, 4
+    STEP(0x378)
+    c.executeOpcode(0xD9B4);
+  L_37A: // A4A1  LD I, 0x4A1
+    STEP(0x37A)
+    c.I = 0x4A1;
+  L_37C: // 660F  LD V6, 0x0F
+    STEP(0x37C)
+    c.V[0x6] = 0x0F;
+  L_37E: // 8666  SHR V6, V6
+    STEP(0x37E)
+    if (c.quirks.shiftUsesVy)
+      c.V[0x6] = c.V[0x6];
+    c.V[0xF] = c.V[0x6] & 0x1;
+    c.V[0x6] >>= 1;
+  L_380: // 4607  SNE V6, 0x07
+    STEP(0x380)
+    if (c.V[0x6] != 0x07)
+      goto L_384;
+  L_382: // A4A5  LD I, 0x4A5  [bloc]
+    STEP(0x382)
+    c.I = 0x4A5;
+  L_384: // DAB4  DRW VA, VB, 4  [bloc]
+    STEP(0x384)
+    c.executeOpcode(0xDAB4);
+  L_386: // 7B05  ADD VB, 0x05
+    STEP(0x386)
+    c.V[0xB] += 0x05;
+  L_388: // A4C9  LD I, 0x4C9
+    STEP(0x388)
+    c.I = 0x4C9;
+  L_38A: // D8B4  DRW V8, VB, 4
+    STEP(0x38A)
+    c.executeOpcode(0xD8B4);
+  L_38C: // A4E1  LD I, 0x4E1
+    STEP(0x38C)
+    c.I = 0x4E1;
+  L_38E: // D9B4  DRW V9, VB, 4
+    STEP(0x38E)
+    c.executeOpcode(0xD9B4);
+  L_390: // A4A1  LD I, 0x4A1
+    STEP(0x390)
+    c.I = 0x4A1;
+  L_392: // 66E0  LD V6, 0xE0
+    STEP(0x392)
+    c.V[0x6] = 0xE0;
+  L_394: // 866E  SHL V6, V6
+    STEP(0x394)
+    if (c.quirks.shiftUsesVy)
+      c.V[0x6] = c.V[0x6];
+    c.V[0xF] = (c.V[0x6] >> 7) & 0x1;
+    c.V[0x6] <<= 1;
+  L_396: // 46C0  SNE V6, 0xC0
+    STEP(0x396)
+    if (c.V[0x6] != 0xC0)
+      goto L_39A;
+  L_398: // A4A5  LD I, 0x4A5  [bloc]
+    STEP(0x398)
+    c.I = 0x4A5;
+  L_39A: // DAB4  DRW VA, VB, 4  [bloc]
+    STEP(0x39A)
+    c.executeOpcode(0xDAB4);
+  L_39C: // 7B05  ADD VB, 0x05
+    STEP(0x39C)
+    c.V[0xB] += 0x05;
+  L_39E: // A4E5  LD I, 0x4E5
+    STEP(0x39E)
+    c.I = 0x4E5;
+  L_3A0: // D8B4  DRW V8, VB, 4
+    STEP(0x3A0)
+    c.executeOpcode(0xD8B4);
+  L_3A2: // A4C1  LD I, 0x4C1
+    STEP(0x3A2)
+    c.I = 0x4C1;
+  L_3A4: // D9B4  DRW V9, VB, 4
+    STEP(0x3A4)
+    c.executeOpcode(0xD9B4);
+  L_3A6: // A49E  LD I, 0x49E
+    STEP(0x3A6)
+    c.I = 0x49E;
+  L_3A8: // F165  LD V1, [I]
+    STEP(0x3A8)
+    c.executeOpcode(0xF165);
+  L_3AA: // A4A5  LD I, 0x4A5
+    STEP(0x3AA)
+    c.I = 0x4A5;
+  L_3AC: // 30AA  SE V0, 0xAA
+    STEP(0x3AC)
+    if (c.V[0x0] == 0xAA)
+      goto L_3B0;
+  L_3AE: // A4A1  LD I, 0x4A1  [bloc]
+    STEP(0x3AE)
+    c.I = 0x4A1;
+  L_3B0: // 3155  SE V1, 0x55  [bloc]
+    STEP(0x3B0)
+    if (c.V[0x1] == 0x55)
+      goto L_3B4;
+  L_3B2: // A4A1  LD I, 0x4A1  [bloc]
+    STEP(0x3B2)
+    c.I = 0x4A1;
+  L_3B4: // DAB4  DRW VA, VB, 4  [bloc]
+    STEP(0x3B4)
+    c.executeOpcode(0xDAB4);
+  L_3B6: // 6832  LD V8, 0x32
+    STEP(0x3B6)
+    c.V[0x8] = 0x32;
+  L_3B8: // 6936  LD V9, 0x36
+    STEP(0x3B8)
+    c.V[0x9] = 0x36;
+  L_3BA: // 6A3B  LD VA, 0x3B
+    STEP(0x3BA)
+    c.V[0xA] = 0x3B;
+  L_3BC: // 6B01  LD VB, 0x01
+    STEP(0x3BC)
+    c.V[0xB] = 0x01;
+  L_3BE: // A4E5  LD I, 0x4E5
+    STEP(0x3BE)
+    c.I = 0x4E5;
+  L_3C0: // D8B4  DRW V8, VB, 4
+    STEP(0x3C0)
+    c.executeOpcode(0xD8B4);
+  L_3C2: // A4BD  LD I, 0x4BD
+    STEP(0x3C2)
+    c.I = 0x4BD;
+  L_3C4: // D9B4  DRW V9, VB, 4
+    STEP(0x3C4)
+    c.executeOpcode(0xD9B4);
+  L_3C6: // A49E  LD I, 0x49E
+    STEP(0x3C6)
+    c.I = 0x49E;
+  L_3C8: // 6000  LD V0, 0x00
+    STEP(0x3C8)
+    c.V[0x0] = 0x00;
+  L_3CA: // 6130  LD V1, 0x30
+    STEP(0x3CA)
+    c.V[0x1] = 0x30;
+  L_3CC: // F155  LD [I], V1
+    STEP(0x3CC)
+    {
+      uint16_t addr = c.I;
+      c.executeOpcode(0xF155);
+      if (!codeIntact(addr, 2)) {
+        valid = false;
+        c.pc = 0x3CE;
+        continue;
+      }
+    }
+  L_3CE: // A49E  LD I, 0x49E
+    STEP(0x3CE)
+    c.I = 0x49E;
+  L_3D0: // F065  LD V0, [I]
+    STEP(0x3D0)
+    c.executeOpcode(0xF065);
+  L_3D2: // 8100  LD V1, V0
+    STEP(0x3D2)
+    c.V[0x1] = c.V[0x0];
+  L_3D4: // A49F  LD I, 0x49F
+    STEP(0x3D4)
+    c.I = 0x49F;
+  L_3D6: // F065  LD V0, [I]
+    STEP(0x3D6)
+    c.executeOpcode(0xF065);
+  L_3D8: // A4A5  LD I, 0x4A5
+    STEP(0x3D8)
+    c.I = 0x4A5;
+  L_3DA: // 3030  SE V0, 0x30
+    STEP(0x3DA)
+    if (c.V[0x0] == 0x30)
+      goto L_3DE;
+  L_3DC: // A4A1  LD I, 0x4A1  [bloc]
+    STEP(0x3DC)
+    c.I = 0x4A1;
+  L_3DE: // 3100  SE V1, 0x00  [bloc]
+    STEP(0x3DE)
+    if (c.V[0x1] == 0x00)
+      goto L_3E2;
+  L_3E0: // A4A1  LD I, 0x4A1  [bloc]
+    STEP(0x3E0)
+    c.I = 0x4A1;
+  L_3E2: // DAB4  DRW VA, VB, 4  [bloc]
+    STEP(0x3E2)
+    c.executeOpcode(0xDAB4);
+  L_3E4: // 7B05  ADD VB, 0x05
+    STEP(0x3E4)
+    c.V[0xB] += 0x05;
+  L_3E6: // A4E5  LD I, 0x4E5
+    STEP(0x3E6)
+    c.I = 0x4E5;
+  L_3E8: // D8B4  DRW V8, VB, 4
+    STEP(0x3E8)
+    c.executeOpcode(0xD8B4);
+  L_3EA: // A4B5  LD I, 0x4B5
+    STEP(0x3EA)
+    c.I = 0x4B5;
+  L_3EC: // D9B4  DRW V9, VB, 4
+    STEP(0x3EC)
+    c.executeOpcode(0xD9B4);
+  L_3EE: // A49E  LD I, 0x49E
+    STEP(0x3EE)
+    c.I = 0x49E;
+  L_3F0: // 6689  LD V6, 0x89
+    STEP(0x3F0)
+    c.V[0x6] = 0x89;
+  L_3F2: // F633  LD B, V6
+    STEP(0x3F2)
+    {
+      uint16_t addr = c.I;
+      c.executeOpcode(0xF633);
+      if (!codeIntact(addr, 3)) {
+        valid = false;
+        c.pc = 0x3F4;
+        continue;
+      }
+    }
+  L_3F4: // F265  LD V2, [I]
+    STEP(0x3F4)
+    c.executeOpcode(0xF265);
+  L_3F6: // A4A1  LD I, 0x4A1
+    STEP(0x3F6)
+    c.I = 0x4A1;
+  L_3F8: // 3001  SE V0, 0x01
+    STEP(0x3F8)
+    if (c.V[0x0] == 0x01)
+      goto L_3FC;
+  L_3FA: // 1432  JP 0x432  [bloc]
+    STEP(0x3FA)
+    goto L_432;
+  L_3FC: // 3103  SE V1, 0x03  [bloc]
+    STEP(0x3FC)
+    if (c.V[0x1] == 0x03)
+      goto L_400;
+  L_3FE: // 1432  JP 0x432  [bloc]
+    STEP(0x3FE)
+    goto L_432;
+  L_400: // 3207  SE V2, 0x07  [bloc]
+    STEP(0x400)
+    if (c.V[0x2] == 0x07)
+      goto L_404;
+  L_402: // 1432  JP 0x432  [bloc]
+    STEP(0x402)
+    goto L_432;
+  L_404: // A49E  LD I, 0x49E  [bloc]
+    STEP(0x404)
+    c.I = 0x49E;
+  L_406: // 6641  LD V6, 0x41
+    STEP(0x406)
+    c.V[0x6] = 0x41;
+  L_408: // F633  LD B, V6
+    STEP(0x408)
+    {
+      uint16_t addr = c.I;
+      c.executeOpcode(0xF633);
+      if (!codeIntact(addr, 3)) {
+        valid = false;
+        c.pc = 0x40A;
+        continue;
+      }
+    }
+  L_40A: // F265  LD V2, [I]
+    STEP(0x40A)
+    c.executeOpcode(0xF265);
+  L_40C: // A4A1  LD I, 0x4A1
+    STEP(0x40C)
+    c.I = 0x4A1;
+  L_40E: // 3000  SE V0, 0x00
+    STEP(0x40E)
+    if (c.V[0x0] == 0x00)
+      goto L_412;
+  L_410: // 1432  JP 0x432  [bloc]
+    STEP(0x410)
+    goto L_432;
+  L_412: // 3106  SE V1, 0x06  [bloc]
+    STEP(0x412)
+    if (c.V[0x1] == 0x06)
+      goto L_416;
+  L_414: // 1432  JP 0x432  [bloc]
+    STEP(0x414)
+    goto L_432;
+  L_416: // 3205  SE V2, 0x05  [bloc]
+    STEP(0x416)
+    if (c.V[0x2] == 0x05)
+      goto L_41A;
+  L_418: // 1432  JP 0x432  [bloc]
+    STEP(0x418)
+    goto L_432;
+  L_41A: // A49E  LD I, 0x49E  [bloc]
+    STEP(0x41A)
+    c.I = 0x49E;
+  L_41C: // 6604  LD V6, 0x04
+    STEP(0x41C)
+    c.V[0x6] = 0x04;
+  L_41E: // F633  LD B, V6
+    STEP(0x41E)
+    {
+      uint16_t addr = c.I;
+      c.executeOpcode(0xF633);
+      if (!codeIntact(addr, 3)) {
+        valid = false;
+        c.pc = 0x420;
+        continue;
+      }
+    }
+  L_420: // F265  LD V2, [I]
+    STEP(0x420)
+    c.executeOpcode(0xF265);
+  L_422: // A4A1  LD I, 0x4A1
+    STEP(0x422)
+    c.I = 0x4A1;
+  L_424: // 3000  SE V0, 0x00
+    STEP(0x424)
+    if (c.V[0x0] == 0x00)
+      goto L_428;
+  L_426: // 1432  JP 0x432  [bloc]
+    STEP(0x426)
+    goto L_432;
+  L_428: // 3100  SE V1, 0x00  [bloc]
+    STEP(0x428)
+    if (c.V[0x1] == 0x00)
+      goto L_42C;
+  L_42A: // 1432  JP 0x432  [bloc]
+    STEP(0x42A)
+    goto L_432;
+  L_42C: // 3204  SE V2, 0x04  [bloc]
+    STEP(0x42C)
+    if (c.V[0x2] == 0x04)
+      goto L_430;
+  L_42E: // 1432  JP 0x432  [bloc]
+    STEP(0x42E)
+    goto L_432;
+  L_430: // A4A5  LD I, 0x4A5  [bloc]
+    STEP(0x430)
+    c.I = 0x4A5;
+  L_432: // DAB4  DRW VA, VB, 4  [bloc]
+    STEP(0x432)
+    c.executeOpcode(0xDAB4);
+  L_434: // 7B05  ADD VB, 0x05
+    STEP(0x434)
+    c.V[0xB] += 0x05;
+  L_436: // A4E5  LD I, 0x4E5
+    STEP(0x436)
+    c.I = 0x4E5;
+  L_438: // D8B4  DRW V8, VB, 4
+    STEP(0x438)
+    c.executeOpcode(0xD8B4);
+  L_43A: // A4E1  LD I, 0x4E1
+    STEP(0x43A)
+    c.I = 0x4E1;
+  L_43C: // D9B4  DRW V9, VB, 4
+    STEP(0x43C)
+    c.executeOpcode(0xD9B4);
+  L_43E: // A4A1  LD I, 0x4A1
+    STEP(0x43E)
+    c.I = 0x4A1;
+  L_440: // 6604  LD V6, 0x04
+    STEP(0x440)
+    c.V[0x6] = 0x04;
+  L_442: // F61E  ADD I, V6
+    STEP(0x442)
+    c.I += c.V[0x6];
+  L_444: // DAB4  DRW VA, VB, 4
+    STEP(0x444)
+    c.executeOpcode(0xDAB4);
+  L_446: // 7B05  ADD VB, 0x05
+    STEP(0x446)
+    c.V[0xB] += 0x05;
+  L_448: // A4E9  LD I, 0x4E9
+    STEP(0x448)
+    c.I = 0x4E9;
+  L_44A: // D8B4  DRW V8, VB, 4
+    STEP(0x44A)
+    c.executeOpcode(0xD8B4);
+  L_44C: // A4ED  LD I, 0x4ED
+    STEP(0x44C)
+    c.I = 0x4ED;
+  L_44E: // D9B4  DRW V9, VB, 4
+    STEP(0x44E)
+    c.executeOpcode(0xD9B4);
+  L_450: // A4A5  LD I, 0x4A5
+    STEP(0x450)
+    c.I = 0x4A5;
+  L_452: // 66FF  LD V6, 0xFF
+    STEP(0x452)
+    c.V[0x6] = 0xFF;
+  L_454: // 760A  ADD V6, 0x0A
+    STEP(0x454)
+    c.V[0x6] += 0x0A;
+  L_456: // 3609  SE V6, 0x09
+    STEP(0x456)
+    if (c.V[0x6] == 0x09)
+      goto L_45A;
+  L_458: // A4A1  LD I, 0x4A1  [bloc]
+    STEP(0x458)
+    c.I = 0x4A1;
+  L_45A: // 8666  SHR V6, V6  [bloc]
+    STEP(0x45A)
+    if (c.quirks.shiftUsesVy)
+      c.V[0x6] = c.V[0x6];
+    c.V[0xF] = c.V[0x6] & 0x1;
+    c.V[0x6] >>= 1;
+  L_45C: // 3604  SE V6, 0x04
+    STEP(0x45C)
+    if (c.V[0x6] == 0x04)
+      goto L_460;
+  L_45E: // A4A1  LD I, 0x4A1  [bloc]
+    STEP(0x45E)
+    c.I = 0x4A1;
+  L_460: // 66FF  LD V6, 0xFF  [bloc]
+    STEP(0x460)
+    c.V[0x6] = 0xFF;
+  L_462: // 600A  LD V0, 0x0A
+    STEP(0x462)
+    c.V[0x0] = 0x0A;
+  L_464: // 8604  ADD V6, V0
+    STEP(0x464)
+    {
+      uint16_t sum = c.V[0x6] + c.V[0x0];
+      c.V[0xF] = (sum > 255) ? 1 : 0;
+      c.V[0x6] = sum & 0xFF;
+    }
+  L_466: // 3609  SE V6, 0x09
+    STEP(0x466)
+    if (c.V[0x6] == 0x09)
+      goto L_46A;
+  L_468: // A4A1  LD I, 0x4A1  [bloc]
+    STEP(0x468)
+    c.I = 0x4A1;
+  L_46A: // 8666  SHR V6, V6  [bloc]
+    STEP(0x46A)
+    if (c.quirks.shiftUsesVy)
+      c.V[0x6] = c.V[0x6];
+    c.V[0xF] = c.V[0x6] & 0x1;
+    c.V[0x6] >>= 1;
+  L_46C: // 3604  SE V6, 0x04
+    STEP(0x46C)
+    if (c.V[0x6] == 0x04)
+      goto L_470;
+  L_46E: // A4A1  LD I, 0x4A1  [bloc]
+    STEP(0x46E)
+    c.I = 0x4A1;
+  L_470: // 66FF  LD V6, 0xFF  [bloc]
+    STEP(0x470)
+    c.V[0x6] = 0xFF;
+  L_472: // 866E  SHL V6, V6
+    STEP(0x472)
+    if (c.quirks.shiftUsesVy)
+      c.V[0x6] = c.V[0x6];
+    c.V[0xF] = (c.V[0x6] >> 7) & 0x1;
+    c.V[0x6] <<= 1;
+  L_474: // 8666  SHR V6, V6
+    STEP(0x474)
+    if (c.quirks.shiftUsesVy)
+      c.V[0x6] = c.V[0x6];
+    c.V[0xF] = c.V[0x6] & 0x1;
+    c.V[0x6] >>= 1;
+  L_476: // 367F  SE V6, 0x7F
+    STEP(0x476)
+    if (c.V[0x6] == 0x7F)
+      goto L_47A;
+  L_478: // A4A1  LD I, 0x4A1  [bloc]
+    STEP(0x478)
+    c.I = 0x4A1;
+  L_47A: // 8666  SHR V6, V6  [bloc]
+    STEP(0x47A)
+    if (c.quirks.shiftUsesVy)
+      c.V[0x6] = c.V[0x6];
+    c.V[0xF] = c.V[0x6] & 0x1;
+    c.V[0x6] >>= 1;
+  L_47C: // 866E  SHL V6, V6
+    STEP(0x47C)
+    if (c.quirks.shiftUsesVy)
+      c.V[0x6] = c.V[0x6];
+    c.V[0xF] = (c.V[0x6] >> 7) & 0x1;
+    c.V[0x6] <<= 1;
+  L_47E: // 367E  SE V6, 0x7E
+    STEP(0x47E)
+    if (c.V[0x6] == 0x7E)
+      goto L_482;
+  L_480: // A4A1  LD I, 0x4A1  [bloc]
+    STEP(0x480)
+    c.I = 0x4A1;
+  L_482: // 6605  LD V6, 0x05  [bloc]
+    STEP(0x482)
+    c.V[0x6] = 0x05;
+  L_484: // 76F6  ADD V6, 0xF6
+    STEP(0x484)
+    c.V[0x6] += 0xF6;
+  L_486: // 36FB  SE V6, 0xFB
+    STEP(0x486)
+    if (c.V[0x6] == 0xFB)
+      goto L_48A;
+  L_488: // A4A1  LD I, 0x4A1  [bloc]
+    STEP(0x488)
+    c.I = 0x4A1;
+  L_48A: // 6605  LD V6, 0x05  [bloc]
+    STEP(0x48A)
+    c.V[0x6] = 0x05;
+  L_48C: // 8605  SUB V6, V0
+    STEP(0x48C)
+    c.V[0xF] = (c.V[0x6] > c.V[0x0]) ? 1 : 0;
+    c.V[0x6] -= c.V[0x0];
+  L_48E: // 36FB  SE V6, 0xFB
+    STEP(0x48E)
+    if (c.V[0x6] == 0xFB)
+      goto L_492;
+  L_490: // A4A1  LD I, 0x4A1  [bloc]
+    STEP(0x490)
+    c.I = 0x4A1;
+  L_492: // 6605  LD V6, 0x05  [bloc]
+    STEP(0x492)
+    c.V[0x6] = 0x05;
+  L_494: // 8067  SUBN V0, V6
+    STEP(0x494)
+    c.V[0xF] = (c.V[0x6] > c.V[0x0]) ? 1 : 0;
+    c.V[0x0] = c.V[0x6] - c.V[0x0];
+  L_496: // 30FB  SE V0, 0xFB
+    STEP(0x496)
+    if (c.V[0x0] == 0xFB)
+      goto L_49A;
+  L_498: // A4A1  LD I, 0x4A1  [bloc]
+    STEP(0x498)
+    c.I = 0x4A1;
+  L_49A: // DAB4  DRW VA, VB, 4  [bloc]
+    STEP(0x49A)
+    c.executeOpcode(0xDAB4);
+  L_49C: // 149C  JP 0x49C  [bloc]
+    STEP(0x49C)
+    goto L_49C;
+  }
+
+  return executed;
+}
@@ -0,0 +1,793 @@
+// Genere par chip8-aot a partir de pong.ch8 : ne pas modifier.
+// 246 bytes, 117 instructions traduites, 0 saut(s) indirect(s) BNNN
+
+#include "chip8_native.hpp"
+#include "latency.hpp"
+
+const uint8_t Chip8Native::ROM[] = {
+    0x6A, 0x02, 0x6B, 0x0C, 0x6C, 0x3F, 0x6D, 0x0C, 0xA2, 0xEA, 0xDA, 0xB6,
+    0xDC, 0xD6, 0x6E, 0x00, 0x22, 0xD4, 0x66, 0x03, 0x68, 0x02, 0x60, 0x60,
+    0xF0, 0x15, 0xF0, 0x07, 0x30, 0x00, 0x12, 0x1A, 0xC7, 0x17, 0x77, 0x08,
+    0x69, 0xFF, 0xA2, 0xF0, 0xD6, 0x71, 0xA2, 0xEA, 0xDA, 0xB6, 0xDC, 0xD6,
+    0x60, 0x01, 0xE0, 0xA1, 0x7B, 0xFE, 0x60, 0x04, 0xE0, 0xA1, 0x7B, 0x02,
+    0x60, 0x1F, 0x8B, 0x02, 0xDA, 0xB6, 0x60, 0x0C, 0xE0, 0xA1, 0x7D, 0xFE,
+    0x60, 0x0D, 0xE0, 0xA1, 0x7D, 0x02, 0x60, 0x1F, 0x8D, 0x02, 0xDC, 0xD6,
+    0xA2, 0xF0, 0xD6, 0x71, 0x86, 0x84, 0x87, 0x94, 0x60, 0x3F, 0x86, 0x02,
+    0x61, 0x1F, 0x87, 0x12, 0x46, 0x02, 0x12, 0x78, 0x46, 0x3F, 0x12, 0x82,
+    0x47, 0x1F, 0x69, 0xFF, 0x47, 0x00, 0x69, 0x01, 0xD6, 0x71, 0x12, 0x2A,
+    0x68, 0x02, 0x63, 0x01, 0x80, 0x70, 0x80, 0xB5, 0x12, 0x8A, 0x68, 0xFE,
+    0x63, 0x0A, 0x80, 0x70, 0x80, 0xD5, 0x3F, 0x01, 0x12, 0xA2, 0x61, 0x02,
+    0x80, 0x15, 0x3F, 0x01, 0x12, 0xBA, 0x80, 0x15, 0x3F, 0x01, 0x12, 0xC8,
+    0x80, 0x15, 0x3F, 0x01, 0x12, 0xC2, 0x60, 0x20, 0xF0, 0x18, 0x22, 0xD4,
+    0x8E, 0x34, 0x22, 0xD4, 0x66, 0x3E, 0x33, 0x01, 0x66, 0x03, 0x68, 0xFE,
+    0x33, 0x01, 0x68, 0x02, 0x12, 0x16, 0x79, 0xFF, 0x49, 0xFE, 0x69, 0xFF,
+    0x12, 0xC8, 0x79, 0x01, 0x49, 0x02, 0x69, 0x01, 0x60, 0x04, 0xF0, 0x18,
+    0x76, 0x01, 0x46, 0x40, 0x76, 0xFE, 0x12, 0x6C, 0xA2, 0xF2, 0xFE, 0x33,
+    0xF2, 0x65, 0xF1, 0x29, 0x64, 0x14, 0x65, 0x00, 0xD4, 0x55, 0x74, 0x15,
+    0xF2, 0x29, 0xD4, 0x55, 0x00, 0xEE, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+const size_t Chip8Native::ROM_SIZE = sizeof(Chip8Native::ROM);
+const char *const Chip8Native::ROM_NAME = "pong";
+
+// Adresses traduites (1 bit par adresse)
+static const uint8_t CODE_MAP[Chip8::MEMORY_SIZE / 8] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static bool isCode(unsigned addr) {
+  return addr < Chip8::MEMORY_SIZE && ((CODE_MAP[addr >> 3] >> (addr & 7)) & 1);
+}
+
+bool Chip8Native::codeIntact(unsigned first, unsigned count) const {
+  for (unsigned a = first; a < first + count && a < Chip8::MEMORY_SIZE; ++a) {
+    // Une instruction couvre les octets a et a + 1
+    bool covered = isCode(a) || (a > 0 && isCode(a - 1));
+    if (covered && chip8.memory[a] != ROM[a - Chip8::START_ADDRESS])
+      return false;
+  }
+  return true;
+}
+
+void Chip8Native::reset() {
+  valid = codeIntact(Chip8::START_ADDRESS, static_cast<unsigned>(ROM_SIZE));
+}
+
+void Chip8Native::checkStore(uint16_t opcode) {
+  unsigned count = 0;
+  if ((opcode & 0xF0FF) == 0xF033)
+    count = 3;
+  else if ((opcode & 0xF0FF) == 0xF055)
+    count = ((opcode >> 8) & 0x0F) + 1;
+
+  if (count && !codeIntact(chip8.I, count))
+    valid = false;
+}
+
+// Budget epuise : on s'arrete avant l'instruction addr
+#define STEP(addr)                                                             \
+  if (executed == budget) {                                                    \
+    c.pc = addr;                                                               \
+    return executed;                                                           \
+  }                                                                            \
+  ++executed;
+
+int Chip8Native::run(int budget) {
+  Chip8 &c = chip8;
+  int executed = 0;
+
+  while (executed < budget) {
+    if (valid) {
+      switch (c.pc) {
+      case 0x200:
+        goto L_200;
+      case 0x202:
+        goto L_202;
+      case 0x204:
+        goto L_204;
+      case 0x206:
+        goto L_206;
+      case 0x208:
+        goto L_208;
+      case 0x20A:
+        goto L_20A;
+      case 0x20C:
+        goto L_20C;
+      case 0x20E:
+        goto L_20E;
+      case 0x210:
+        goto L_210;
+      case 0x212:
+        goto L_212;
+      case 0x214:
+        goto L_214;
+      case 0x216:
+        goto L_216;
+      case 0x218:
+        goto L_218;
+      case 0x21A:
+        goto L_21A;
+      case 0x21C:
+        goto L_21C;
+      case 0x21E:
+        goto L_21E;
+      case 0x220:
+        goto L_220;
+      case 0x222:
+        goto L_222;
+      case 0x224:
+        goto L_224;
+      case 0x226:
+        goto L_226;
+      case 0x228:
+        goto L_228;
+      case 0x22A:
+        goto L_22A;
+      case 0x22C:
+        goto L_22C;
+      case 0x22E:
+        goto L_22E;
+      case 0x230:
+        goto L_230;
+      case 0x232:
+        goto L_232;
+      case 0x234:
+        goto L_234;
+      case 0x236:
+        goto L_236;
+      case 0x238:
+        goto L_238;
+      case 0x23A:
+        goto L_23A;
+      case 0x23C:
+        goto L_23C;
+      case 0x23E:
+        goto L_23E;
+      case 0x240:
+        goto L_240;
+      case 0x242:
+        goto L_242;
+      case 0x244:
+        goto L_244;
+      case 0x246:
+        goto L_246;
+      case 0x248:
+        goto L_248;
+      case 0x24A:
+        goto L_24A;
+      case 0x24C:
+        goto L_24C;
+      case 0x24E:
+        goto L_24E;
+      case 0x250:
+        goto L_250;
+      case 0x252:
+        goto L_252;
+      case 0x254:
+        goto L_254;
+      case 0x256:
+        goto L_256;
+      case 0x258:
+        goto L_258;
+      case 0x25A:
+        goto L_25A;
+      case 0x25C:
+        goto L_25C;
+      case 0x25E:
+        goto L_25E;
+      case 0x260:
+        goto L_260;
+      case 0x262:
+        goto L_262;
+      case 0x264:
+        goto L_264;
+      case 0x266:
+        goto L_266;
+      case 0x268:
+        goto L_268;
+      case 0x26A:
+        goto L_26A;
+      case 0x26C:
+        goto L_26C;
+      case 0x26E:
+        goto L_26E;
+      case 0x270:
+        goto L_270;
+      case 0x272:
+        goto L_272;
+      case 0x274:
+        goto L_274;
+      case 0x276:
+        goto L_276;
+      case 0x278:
+        goto L_278;
+      case 0x27A:
+        goto L_27A;
+      case 0x27C:
+        goto L_27C;
+      case 0x27E:
+        goto L_27E;
+      case 0x280:
+        goto L_280;
+      case 0x282:
+        goto L_282;
+      case 0x284:
+        goto L_284;
+      case 0x286:
+        goto L_286;
+      case 0x288:
+        goto L_288;
+      case 0x28A:
+        goto L_28A;
+      case 0x28C:
+        goto L_28C;
+      case 0x28E:
+        goto L_28E;
+      case 0x290:
+        goto L_290;
+      case 0x292:
+        goto L_292;
+      case 0x294:
+        goto L_294;
+      case 0x296:
+        goto L_296;
+      case 0x298:
+        goto L_298;
+      case 0x29A:
+        goto L_29A;
+      case 0x29C:
+        goto L_29C;
+      case 0x29E:
+        goto L_29E;
+      case 0x2A0:
+        goto L_2A0;
+      case 0x2A2:
+        goto L_2A2;
+      case 0x2A4:
+        goto L_2A4;
+      case 0x2A6:
+        goto L_2A6;
+      case 0x2A8:
+        goto L_2A8;
+      case 0x2AA:
+        goto L_2AA;
+      case 0x2AC:
+        goto L_2AC;
+      case 0x2AE:
+        goto L_2AE;
+      case 0x2B0:
+        goto L_2B0;
+      case 0x2B2:
+        goto L_2B2;
+      case 0x2B4:
+        goto L_2B4;
+      case 0x2B6:
+        goto L_2B6;
+      case 0x2B8:
+        goto L_2B8;
+      case 0x2BA:
+        goto L_2BA;
+      case 0x2BC:
+        goto L_2BC;
+      case 0x2BE:
+        goto L_2BE;
+      case 0x2C0:
+        goto L_2C0;
+      case 0x2C2:
+        goto L_2C2;
+      case 0x2C4:
+        goto L_2C4;
+      case 0x2C6:
+        goto L_2C6;
+      case 0x2C8:
+        goto L_2C8;
+      case 0x2CA:
+        goto L_2CA;
+      case 0x2CC:
+        goto L_2CC;
+      case 0x2CE:
+        goto L_2CE;
+      case 0x2D0:
+        goto L_2D0;
+      case 0x2D2:
+        goto L_2D2;
+      case 0x2D4:
+        goto L_2D4;
+      case 0x2D6:
+        goto L_2D6;
+      case 0x2D8:
+        goto L_2D8;
+      case 0x2DA:
+        goto L_2DA;
+      case 0x2DC:
+        goto L_2DC;
+      case 0x2DE:
+        goto L_2DE;
+      case 0x2E0:
+        goto L_2E0;
+      case 0x2E2:
+        goto L_2E2;
+      case 0x2E4:
+        goto L_2E4;
+      case 0x2E6:
+        goto L_2E6;
+      case 0x2E8:
+        goto L_2E8;
+      default:
+        break;
+      }
+    }
+
+    // Hors du code traduit : interpreteur
+    {
+      uint16_t opcode = (c.readMemory(c.pc) << 8) | c.readMemory(c.pc + 1);
+      c.cycle();
+      ++executed;
+      checkStore(opcode);
+    }
+    continue;
+
+  L_200: // 6A02  LD VA, 0x02  [bloc]
+    STEP(0x200)
+    c.V[0xA] = 0x02;
+  L_202: // 6B0C  LD VB, 0x0C
+    STEP(0x202)
+    c.V[0xB] = 0x0C;
+  L_204: // 6C3F  LD VC, 0x3F
+    STEP(0x204)
+    c.V[0xC] = 0x3F;
+  L_206: // 6D0C  LD VD, 0x0C
+    STEP(0x206)
+    c.V[0xD] = 0x0C;
+  L_208: // A2EA  LD I, 0x2EA
+    STEP(0x208)
+    c.I = 0x2EA;
+  L_20A: // DAB6  DRW VA, VB, 6
+    STEP(0x20A)
+    c.executeOpcode(0xDAB6);
+  L_20C: // DCD6  DRW VC, VD, 6
+    STEP(0x20C)
+    c.executeOpcode(0xDCD6);
+  L_20E: // 6E00  LD VE, 0x00
+    STEP(0x20E)
+    c.V[0xE] = 0x00;
+  L_210: // 22D4  CALL 0x2D4
+    STEP(0x210)
+    c.stack[c.sp] = 0x212;
+    ++c.sp;
+    goto L_2D4;
+  L_212: // 6603  LD V6, 0x03  [bloc]
+    STEP(0x212)
+    c.V[0x6] = 0x03;
+  L_214: // 6802  LD V8, 0x02
+    STEP(0x214)
+    c.V[0x8] = 0x02;
+  L_216: // 6060  LD V0, 0x60  [bloc]
+    STEP(0x216)
+    c.V[0x0] = 0x60;
+  L_218: // F015  LD DT, V0
+    STEP(0x218)
+    c.delayTimer = c.V[0x0];
+  L_21A: // F007  LD V0, DT  [bloc]
+    STEP(0x21A)
+    c.V[0x0] = c.delayTimer;
+  L_21C: // 3000  SE V0, 0x00
+    STEP(0x21C)
+    if (c.V[0x0] == 0x00)
+      goto L_220;
+  L_21E: // 121A  JP 0x21A  [bloc]
+    STEP(0x21E)
+    goto L_21A;
+  L_220: // C717  RND V7, 0x17  [bloc]
+    STEP(0x220)
+    c.V[0x7] = c.randByte(c.rng) & 0x17;
+  L_222: // 7708  ADD V7, 0x08
+    STEP(0x222)
+    c.V[0x7] += 0x08;
+  L_224: // 69FF  LD V9, 0xFF
+    STEP(0x224)
+    c.V[0x9] = 0xFF;
+  L_226: // A2F0  LD I, 0x2F0
+    STEP(0x226)
+    c.I = 0x2F0;
+  L_228: // D671  DRW V6, V7, 1
+    STEP(0x228)
+    c.executeOpcode(0xD671);
+  L_22A: // A2EA  LD I, 0x2EA  [bloc]
+    STEP(0x22A)
+    c.I = 0x2EA;
+  L_22C: // DAB6  DRW VA, VB, 6
+    STEP(0x22C)
+    c.executeOpcode(0xDAB6);
+  L_22E: // DCD6  DRW VC, VD, 6
+    STEP(0x22E)
+    c.executeOpcode(0xDCD6);
+  L_230: // 6001  LD V0, 0x01
+    STEP(0x230)
+    c.V[0x0] = 0x01;
+  L_232: // E0A1  SKNP V0
+    STEP(0x232)
+    if (c.latency)
+      c.latency->onKeyRead(c.V[0x0]);
+    if (!c.keypad[c.V[0x0]])
+      goto L_236;
+  L_234: // 7BFE  ADD VB, 0xFE  [bloc]
+    STEP(0x234)
+    c.V[0xB] += 0xFE;
+  L_236: // 6004  LD V0, 0x04  [bloc]
+    STEP(0x236)
+    c.V[0x0] = 0x04;
+  L_238: // E0A1  SKNP V0
+    STEP(0x238)
+    if (c.latency)
+      c.latency->onKeyRead(c.V[0x0]);
+    if (!c.keypad[c.V[0x0]])
+      goto L_23C;
+  L_23A: // 7B02  ADD VB, 0x02  [bloc]
+    STEP(0x23A)
+    c.V[0xB] += 0x02;
+  L_23C: // 601F  LD V0, 0x1F  [bloc]
+    STEP(0x23C)
+    c.V[0x0] = 0x1F;
+  L_23E: // 8B02  AND VB, V0
+    STEP(0x23E)
+    c.V[0xB] &= c.V[0x0];
+    if (c.quirks.vfReset)
+      c.V[0xF] = 0;
+  L_240: // DAB6  DRW VA, VB, 6
+    STEP(0x240)
+    c.executeOpcode(0xDAB6);
+  L_242: // 600C  LD V0, 0x0C
+    STEP(0x242)
+    c.V[0x0] = 0x0C;
+  L_244: // E0A1  SKNP V0
+    STEP(0x244)
+    if (c.latency)
+      c.latency->onKeyRead(c.V[0x0]);
+    if (!c.keypad[c.V[0x0]])
+      goto L_248;
+  L_246: // 7DFE  ADD VD, 0xFE  [bloc]
+    STEP(0x246)
+    c.V[0xD] += 0xFE;
+  L_248: // 600D  LD V0, 0x0D  [bloc]
+    STEP(0x248)
+    c.V[0x0] = 0x0D;
+  L_24A: // E0A1  SKNP V0
+    STEP(0x24A)
+    if (c.latency)
+      c.latency->onKeyRead(c.V[0x0]);
+    if (!c.keypad[c.V[0x0]])
+      goto L_24E;
+  L_24C: // 7D02  ADD VD, 0x02  [bloc]
+    STEP(0x24C)
+    c.V[0xD] += 0x02;
+  L_24E: // 601F  LD V0, 0x1F  [bloc]
+    STEP(0x24E)
+    c.V[0x0] = 0x1F;
+  L_250: // 8D02  AND VD, V0
+    STEP(0x250)
+    c.V[0xD] &= c.V[0x0];
+    if (c.quirks.vfReset)
+      c.V[0xF] = 0;
+  L_252: // DCD6  DRW VC, VD, 6
+    STEP(0x252)
+    c.executeOpcode(0xDCD6);
+  L_254: // A2F0  LD I, 0x2F0
+    STEP(0x254)
+    c.I = 0x2F0;
+  L_256: // D671  DRW V6, V7, 1
+    STEP(0x256)
+    c.executeOpcode(0xD671);
+  L_258: // 8684  ADD V6, V8
+    STEP(0x258)
+    {
+      uint16_t sum = c.V[0x6] + c.V[0x8];
+      c.V[0xF] = (sum > 255) ? 1 : 0;
+      c.V[0x6] = sum & 0xFF;
+    }
+  L_25A: // 8794  ADD V7, V9
+    STEP(0x25A)
+    {
+      uint16_t sum = c.V[0x7] + c.V[0x9];
+      c.V[0xF] = (sum > 255) ? 1 : 0;
+      c.V[0x7] = sum & 0xFF;
+    }
+  L_25C: // 603F  LD V0, 0x3F
+    STEP(0x25C)
+    c.V[0x0] = 0x3F;
+  L_25E: // 8602  AND V6, V0
+    STEP(0x25E)
+    c.V[0x6] &= c.V[0x0];
+    if (c.quirks.vfReset)
+      c.V[0xF] = 0;
+  L_260: // 611F  LD V1, 0x1F
+    STEP(0x260)
+    c.V[0x1] = 0x1F;
+  L_262: // 8712  AND V7, V1
+    STEP(0x262)
+    c.V[0x7] &= c.V[0x1];
+    if (c.quirks.vfReset)
+      c.V[0xF] = 0;
+  L_264: // 4602  SNE V6, 0x02
+    STEP(0x264)
+    if (c.V[0x6] != 0x02)
+      goto L_268;
+  L_266: // 1278  JP 0x278  [bloc]
+    STEP(0x266)
+    goto L_278;
+  L_268: // 463F  SNE V6, 0x3F  [bloc]
+    STEP(0x268)
+    if (c.V[0x6] != 0x3F)
+      goto L_26C;
+  L_26A: // 1282  JP 0x282  [bloc]
+    STEP(0x26A)
+    goto L_282;
+  L_26C: // 471F  SNE V7, 0x1F  [bloc]
+    STEP(0x26C)
+    if (c.V[0x7] != 0x1F)
+      goto L_270;
+  L_26E: // 69FF  LD V9, 0xFF  [bloc]
+    STEP(0x26E)
+    c.V[0x9] = 0xFF;
+  L_270: // 4700  SNE V7, 0x00  [bloc]
+    STEP(0x270)
+    if (c.V[0x7] != 0x00)
+      goto L_274;
+  L_272: // 6901  LD V9, 0x01  [bloc]
+    STEP(0x272)
+    c.V[0x9] = 0x01;
+  L_274: // D671  DRW V6, V7, 1  [bloc]
+    STEP(0x274)
+    c.executeOpcode(0xD671);
+  L_276: // 122A  JP 0x22A
+    STEP(0x276)
+    goto L_22A;
+  L_278: // 6802  LD V8, 0x02  [bloc]
+    STEP(0x278)
+    c.V[0x8] = 0x02;
+  L_27A: // 6301  LD V3, 0x01
+    STEP(0x27A)
+    c.V[0x3] = 0x01;
+  L_27C: // 8070  LD V0, V7
+    STEP(0x27C)
+    c.V[0x0] = c.V[0x7];
+  L_27E: // 80B5  SUB V0, VB
+    STEP(0x27E)
+    c.V[0xF] = (c.V[0x0] > c.V[0xB]) ? 1 : 0;
+    c.V[0x0] -= c.V[0xB];
+  L_280: // 128A  JP 0x28A
+    STEP(0x280)
+    goto L_28A;
+  L_282: // 68FE  LD V8, 0xFE  [bloc]
+    STEP(0x282)
+    c.V[0x8] = 0xFE;
+  L_284: // 630A  LD V3, 0x0A
+    STEP(0x284)
+    c.V[0x3] = 0x0A;
+  L_286: // 8070  LD V0, V7
+    STEP(0x286)
+    c.V[0x0] = c.V[0x7];
+  L_288: // 80D5  SUB V0, VD
+    STEP(0x288)
+    c.V[0xF] = (c.V[0x0] > c.V[0xD]) ? 1 : 0;
+    c.V[0x0] -= c.V[0xD];
+  L_28A: // 3F01  SE VF, 0x01  [bloc]
+    STEP(0x28A)
+    if (c.V[0xF] == 0x01)
+      goto L_28E;
+  L_28C: // 12A2  JP 0x2A2  [bloc]
+    STEP(0x28C)
+    goto L_2A2;
+  L_28E: // 6102  LD V1, 0x02  [bloc]
+    STEP(0x28E)
+    c.V[0x1] = 0x02;
+  L_290: // 8015  SUB V0, V1
+    STEP(0x290)
+    c.V[0xF] = (c.V[0x0] > c.V[0x1]) ? 1 : 0;
+    c.V[0x0] -= c.V[0x1];
+  L_292: // 3F01  SE VF, 0x01
+    STEP(0x292)
+    if (c.V[0xF] == 0x01)
+      goto L_296;
+  L_294: // 12BA  JP 0x2BA  [bloc]
+    STEP(0x294)
+    goto L_2BA;
+  L_296: // 8015  SUB V0, V1  [bloc]
+    STEP(0x296)
+    c.V[0xF] = (c.V[0x0] > c.V[0x1]) ? 1 : 0;
+    c.V[0x0] -= c.V[0x1];
+  L_298: // 3F01  SE VF, 0x01
+    STEP(0x298)
+    if (c.V[0xF] == 0x01)
+      goto L_29C;
+  L_29A: // 12C8  JP 0x2C8  [bloc]
+    STEP(0x29A)
+    goto L_2C8;
+  L_29C: // 8015  SUB V0, V1  [bloc]
+    STEP(0x29C)
+    c.V[0xF] = (c.V[0x0] > c.V[0x1]) ? 1 : 0;
+    c.V[0x0] -= c.V[0x1];
+  L_29E: // 3F01  SE VF, 0x01
+    STEP(0x29E)
+    if (c.V[0xF] == 0x01)
+      goto L_2A2;
+  L_2A0: // 12C2  JP 0x2C2  [bloc]
+    STEP(0x2A0)
+    goto L_2C2;
+  L_2A2: // 6020  LD V0, 0x20  [bloc]
+    STEP(0x2A2)
+    c.V[0x0] = 0x20;
+  L_2A4: // F018  LD ST, V0
+    STEP(0x2A4)
+    c.soundTimer = c.V[0x0];
+  L_2A6: // 22D4  CALL 0x2D4
+    STEP(0x2A6)
+    c.stack[c.sp] = 0x2A8;
+    ++c.sp;
+    goto L_2D4;
+  L_2A8: // 8E34  ADD VE, V3  [bloc]
+    STEP(0x2A8)
+    {
+      uint16_t sum = c.V[0xE] + c.V[0x3];
+      c.V[0xF] = (sum > 255) ? 1 : 0;
+      c.V[0xE] = sum & 0xFF;
+    }
+  L_2AA: // 22D4  CALL 0x2D4
+    STEP(0x2AA)
+    c.stack[c.sp] = 0x2AC;
+    ++c.sp;
+    goto L_2D4;
+  L_2AC: // 663E  LD V6, 0x3E  [bloc]
+    STEP(0x2AC)
+    c.V[0x6] = 0x3E;
+  L_2AE: // 3301  SE V3, 0x01
+    STEP(0x2AE)
+    if (c.V[0x3] == 0x01)
+      goto L_2B2;
+  L_2B0: // 6603  LD V6, 0x03  [bloc]
+    STEP(0x2B0)
+    c.V[0x6] = 0x03;
+  L_2B2: // 68FE  LD V8, 0xFE  [bloc]
+    STEP(0x2B2)
+    c.V[0x8] = 0xFE;
+  L_2B4: // 3301  SE V3, 0x01
+    STEP(0x2B4)
+    if (c.V[0x3] == 0x01)
+      goto L_2B8;
+  L_2B6: // 6802  LD V8, 0x02  [bloc]
+    STEP(0x2B6)
+    c.V[0x8] = 0x02;
+  L_2B8: // 1216  JP 0x216  [bloc]
+    STEP(0x2B8)
+    goto L_216;
+  L_2BA: // 79FF  ADD V9, 0xFF  [bloc]
+    STEP(0x2BA)
+    c.V[0x9] += 0xFF;
+  L_2BC: // 49FE  SNE V9, 0xFE
+    STEP(0x2BC)
+    if (c.V[0x9] != 0xFE)
+      goto L_2C0;
+  L_2BE: // 69FF  LD V9, 0xFF  [bloc]
+    STEP(0x2BE)
+    c.V[0x9] = 0xFF;
+  L_2C0: // 12C8  JP 0x2C8  [bloc]
+    STEP(0x2C0)
+    goto L_2C8;
+  L_2C2: // 7901  ADD V9, 0x01  [bloc]
+    STEP(0x2C2)
+    c.V[0x9] += 0x01;
+  L_2C4: // 4902  SNE V9, 0x02
+    STEP(0x2C4)
+    if (c.V[0x9] != 0x02)
+      goto L_2C8;
+  L_2C6: // 6901  LD V9, 0x01  [bloc]
+    STEP(0x2C6)
+    c.V[0x9] = 0x01;
+  L_2C8: // 6004  LD V0, 0x04  [bloc]
+    STEP(0x2C8)
+    c.V[0x0] = 0x04;
+  L_2CA: // F018  LD ST, V0
+    STEP(0x2CA)
+    c.soundTimer = c.V[0x0];
+  L_2CC: // 7601  ADD V6, 0x01
+    STEP(0x2CC)
+    c.V[0x6] += 0x01;
+  L_2CE: // 4640  SNE V6, 0x40
+    STEP(0x2CE)
+    if (c.V[0x6] != 0x40)
+      goto L_2D2;
+  L_2D0: // 76FE  ADD V6, 0xFE  [bloc]
+    STEP(0x2D0)
+    c.V[0x6] += 0xFE;
+  L_2D2: // 126C  JP 0x26C  [bloc]
+    STEP(0x2D2)
+    goto L_26C;
+  L_2D4: // A2F2  LD I, 0x2F2  [bloc]
+    STEP(0x2D4)
+    c.I = 0x2F2;
+  L_2D6: // FE33  LD B, VE
+    STEP(0x2D6)
+    {
+      uint16_t addr = c.I;
+      c.executeOpcode(0xFE33);
+      if (!codeIntact(addr, 3)) {
+        valid = false;
+        c.pc = 0x2D8;
+        continue;
+      }
+    }
+  L_2D8: // F265  LD V2, [I]
+    STEP(0x2D8)
+    c.executeOpcode(0xF265);
+  L_2DA: // F129  LD F, V1
+    STEP(0x2DA)
+    c.I = Chip8::FONTSET_START + (c.V[0x1] * 5);
+  L_2DC: // 6414  LD V4, 0x14
+    STEP(0x2DC)
+    c.V[0x4] = 0x14;
+  L_2DE: // 6500  LD V5, 0x00
+    STEP(0x2DE)
+    c.V[0x5] = 0x00;
+  L_2E0: // D455  DRW V4, V5, 5
+    STEP(0x2E0)
+    c.executeOpcode(0xD455);
+  L_2E2: // 7415  ADD V4, 0x15
+    STEP(0x2E2)
+    c.V[0x4] += 0x15;
+  L_2E4: // F229  LD F, V2
+    STEP(0x2E4)
+    c.I = Chip8::FONTSET_START + (c.V[0x2] * 5);
+  L_2E6: // D455  DRW V4, V5, 5
+    STEP(0x2E6)
+    c.executeOpcode(0xD455);
+  L_2E8: // 00EE  RET
+    STEP(0x2E8)
+    --c.sp;
+    c.pc = c.stack[c.sp];
+    continue;
+  }
+
+  return executed;
+}
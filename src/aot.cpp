@@ -0,0 +1,443 @@
+// chip8-aot : recompile une ROM CHIP-8 en traduction C++ native.
+//
+// Le graphe de controle est reconstruit depuis START_ADDRESS (cfg.hpp) ;
+// chaque instruction atteignable devient une etiquette dans
+// Chip8Native::run(). Les sauts indirects (BNNN), retours (00EE) et
+// adresses non resolues repassent par un dispatch sur PC, qui retombe sur
+// l'interpreteur pour tout ce qui n'a pas ete traduit.
+
+#include "cfg.hpp"
+#include "chip8.hpp"
+#include "disasm.hpp"
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+static std::string hex(unsigned value, int digits) {
+  char buf[16];
+  std::snprintf(buf, sizeof(buf), "0x%0*X", digits, value);
+  return buf;
+}
+
+static std::string label(unsigned addr) {
+  char buf[16];
+  std::snprintf(buf, sizeof(buf), "L_%03X", addr);
+  return buf;
+}
+
+class Generator {
+public:
+  Generator(const std::vector<uint8_t> &rom, const ControlFlow &cfg)
+      : rom(rom), cfg(cfg) {}
+
+  void emit(std::ostream &out, const std::string &name);
+
+private:
+  const std::vector<uint8_t> &rom;
+  const ControlFlow &cfg;
+
+  uint16_t opcodeAt(unsigned addr) const {
+    unsigned offset = addr - Chip8::START_ADDRESS;
+    return static_cast<uint16_t>((rom[offset] << 8) | rom[offset + 1]);
+  }
+
+  // Transfert vers target : goto direct si traduit, sinon dispatch
+  std::string jump(unsigned target) const {
+    if (target < Chip8::MEMORY_SIZE && cfg.code[target])
+      return "goto " + label(target) + ";";
+    return "{ c.pc = " + hex(target, 3) + "; continue; }";
+  }
+
+  // Corps d'une instruction ; retourne false si le flot ne continue pas
+  // a l'adresse suivante
+  bool emitInstruction(std::ostream &out, unsigned addr);
+};
+
+bool Generator::emitInstruction(std::ostream &out, unsigned addr) {
+  uint16_t opcode = opcodeAt(addr);
+  unsigned x = (opcode >> 8) & 0x0F;
+  unsigned y = (opcode >> 4) & 0x0F;
+  unsigned n = opcode & 0x0F;
+  unsigned nn = opcode & 0xFF;
+  unsigned nnn = opcode & 0x0FFF;
+  unsigned next = addr + 2;
+
+  std::string vx = "c.V[" + hex(x, 1) + "]";
+  std::string vy = "c.V[" + hex(y, 1) + "]";
+  std::string op = hex(opcode, 4);
+  const char *in = "    ";
+
+  switch (opcode & 0xF000) {
+  case 0x0000:
+    if (opcode == 0x00E0) {
+      out << in << "c.display.fill(0);\n" << in << "c.drawFlag = true;\n";
+      return true;
+    }
+    // 00EE
+    out << in << "--c.sp;\n" << in << "c.pc = c.stack[c.sp];\n"
+        << in << "continue;\n";
+    return false;
+
+  case 0x1000:
+    out << in << jump(nnn) << "\n";
+    return false;
+
+  case 0x2000:
+    out << in << "c.stack[c.sp] = " << hex(next, 3) << ";\n"
+        << in << "++c.sp;\n"
+        << in << jump(nnn) << "\n";
+    return false;
+
+  case 0x3000:
+    out << in << "if (" << vx << " == " << hex(nn, 2) << ")\n"
+        << in << "  " << jump(next + 2) << "\n";
+    return true;
+
+  case 0x4000:
+    out << in << "if (" << vx << " != " << hex(nn, 2) << ")\n"
+        << in << "  " << jump(next + 2) << "\n";
+    return true;
+
+  case 0x5000:
+    out << in << "if (" << vx << " == " << vy << ")\n"
+        << in << "  " << jump(next + 2) << "\n";
+    return true;
+
+  case 0x6000:
+    out << in << vx << " = " << hex(nn, 2) << ";\n";
+    return true;
+
+  case 0x7000:
+    out << in << vx << " += " << hex(nn, 2) << ";\n";
+    return true;
+
+  case 0x8000:
+    switch (n) {
+    case 0x0:
+      out << in << vx << " = " << vy << ";\n";
+      break;
+    case 0x1:
+    case 0x2:
+    case 0x3: {
+      static const char *const OPS[] = {"", " |= ", " &= ", " ^= "};
+      out << in << vx << OPS[n] << vy << ";\n"
+          << in << "if (c.quirks.vfReset)\n"
+          << in << "  c.V[0xF] = 0;\n";
+      break;
+    }
+    case 0x4:
+      out << in << "{\n"
+          << in << "  uint16_t sum = " << vx << " + " << vy << ";\n"
+          << in << "  c.V[0xF] = (sum > 255) ? 1 : 0;\n"
+          << in << "  " << vx << " = sum & 0xFF;\n"
+          << in << "}\n";
+      break;
+    case 0x5:
+      out << in << "c.V[0xF] = (" << vx << " > " << vy << ") ? 1 : 0;\n"
+          << in << vx << " -= " << vy << ";\n";
+      break;
+    case 0x6:
+      out << in << "if (c.quirks.shiftUsesVy)\n"
+          << in << "  " << vx << " = " << vy << ";\n"
+          << in << "c.V[0xF] = " << vx << " & 0x1;\n"
+          << in << vx << " >>= 1;\n";
+      break;
+    case 0x7:
+      out << in << "c.V[0xF] = (" << vy << " > " << vx << ") ? 1 : 0;\n"
+          << in << vx << " = " << vy << " - " << vx << ";\n";
+      break;
+    case 0xE:
+      out << in << "if (c.quirks.shiftUsesVy)\n"
+          << in << "  " << vx << " = " << vy << ";\n"
+          << in << "c.V[0xF] = (" << vx << " >> 7) & 0x1;\n"
+          << in << vx << " <<= 1;\n";
+      break;
+    }
+    return true;
+
+  case 0x9000:
+    out << in << "if (" << vx << " != " << vy << ")\n"
+        << in << "  " << jump(next + 2) << "\n";
+    return true;
+
+  case 0xA000:
+    out << in << "c.I = " << hex(nnn, 3) << ";\n";
+    return true;
+
+  case 0xB000:
+    out << in << "c.pc = c.V[c.quirks.jumpUsesVx ? " << hex(x, 1)
+        << " : 0] + " << hex(nnn, 3) << "; // Saut indirect\n"
+        << in << "continue;\n";
+    return false;
+
+  case 0xC000:
+    out << in << vx << " = c.randByte(c.rng) & " << hex(nn, 2) << ";\n";
+    return true;
+
+  case 0xD000:
+    out << in << "c.executeOpcode(" << op << ");\n";
+    return true;
+
+  case 0xE000:
+    out << in << "if (c.latency)\n"
+        << in << "  c.latency->onKeyRead(" << vx << ");\n"
+        << in << "if (" << (nn == 0x9E ? "" : "!") << "c.keypad[" << vx
+        << "])\n"
+        << in << "  " << jump(next + 2) << "\n";
+    return true;
+
+  case 0xF000:
+    switch (nn) {
+    case 0x07:
+      out << in << vx << " = c.delayTimer;\n";
+      return true;
+    case 0x0A:
+      // Attente de touche : l'interpreteur recule PC si rien n'est appuye
+      out << in << "c.pc = " << hex(next, 3) << ";\n"
+          << in << "c.executeOpcode(" << op << ");\n"
+          << in << "continue;\n";
+      return false;
+    case 0x15:
+      out << in << "c.delayTimer = " << vx << ";\n";
+      return true;
+    case 0x18:
+      out << in << "c.soundTimer = " << vx << ";\n";
+      return true;
+    case 0x1E:
+      out << in << "c.I += " << vx << ";\n";
+      return true;
+    case 0x29:
+      out << in << "c.I = Chip8::FONTSET_START + (" << vx << " * 5);\n";
+      return true;
+    case 0x33:
+    case 0x55: {
+      // Ecriture memoire : le code traduit peut devenir obsolete
+      // (I avant l'instruction : FX55 peut l'avancer)
+      unsigned count = nn == 0x33 ? 3 : x + 1;
+      out << in << "{\n"
+          << in << "  uint16_t addr = c.I;\n"
+          << in << "  c.executeOpcode(" << op << ");\n"
+          << in << "  if (!codeIntact(addr, " << count << ")) {\n"
+          << in << "    valid = false;\n"
+          << in << "    c.pc = " << hex(next, 3) << ";\n"
+          << in << "    continue;\n"
+          << in << "  }\n"
+          << in << "}\n";
+      return true;
+    }
+    case 0x65:
+      out << in << "c.executeOpcode(" << op << ");\n";
+      return true;
+    }
+    break;
+  }
+
+  return true;
+}
+
+void Generator::emit(std::ostream &out, const std::string &name) {
+  const unsigned begin = Chip8::START_ADDRESS;
+  const unsigned end = begin + static_cast<unsigned>(rom.size());
+
+  out << "// Genere par chip8-aot a partir de " << name
+      << " : ne pas modifier.\n"
+      << "// " << rom.size() << " bytes, " << cfg.code.count()
+      << " instructions traduites, " << cfg.indirectJumps.size()
+      << " saut(s) indirect(s) BNNN\n\n"
+      << "#include \"chip8_native.hpp\"\n"
+      << "#include \"latency.hpp\"\n\n";
+
+  // ROM embarquee
+  out << "const uint8_t Chip8Native::ROM[] = {";
+  for (size_t i = 0; i < rom.size(); ++i) {
+    out << (i % 12 == 0 ? "\n    " : " ") << hex(rom[i], 2) << ",";
+  }
+  out << "\n};\n"
+      << "const size_t Chip8Native::ROM_SIZE = sizeof(Chip8Native::ROM);\n"
+      << "const char *const Chip8Native::ROM_NAME = \"";
+  for (char ch : fs::path(name).stem().string()) {
+    if (ch == '"' || ch == '\\')
+      out << '\\';
+    out << ch;
+  }
+  out << "\";\n\n";
+
+  // Bitmap des adresses traduites
+  out << "// Adresses traduites (1 bit par adresse)\n"
+      << "static const uint8_t CODE_MAP[Chip8::MEMORY_SIZE / 8] = {";
+  for (unsigned i = 0; i < Chip8::MEMORY_SIZE / 8; ++i) {
+    unsigned bits = 0;
+    for (unsigned b = 0; b < 8; ++b) {
+      if (cfg.code[i * 8 + b])
+        bits |= 1u << b;
+    }
+    out << (i % 12 == 0 ? "\n    " : " ") << hex(bits, 2) << ",";
+  }
+  out << "\n};\n\n";
+
+  out << R"(static bool isCode(unsigned addr) {
+  return addr < Chip8::MEMORY_SIZE && ((CODE_MAP[addr >> 3] >> (addr & 7)) & 1);
+}
+
+bool Chip8Native::codeIntact(unsigned first, unsigned count) const {
+  for (unsigned a = first; a < first + count && a < Chip8::MEMORY_SIZE; ++a) {
+    // Une instruction couvre les octets a et a + 1
+    bool covered = isCode(a) || (a > 0 && isCode(a - 1));
+    if (covered && chip8.memory[a] != ROM[a - Chip8::START_ADDRESS])
+      return false;
+  }
+  return true;
+}
+
+void Chip8Native::reset() {
+  valid = codeIntact(Chip8::START_ADDRESS, static_cast<unsigned>(ROM_SIZE));
+}
+
+void Chip8Native::checkStore(uint16_t opcode) {
+  unsigned count = 0;
+  if ((opcode & 0xF0FF) == 0xF033)
+    count = 3;
+  else if ((opcode & 0xF0FF) == 0xF055)
+    count = ((opcode >> 8) & 0x0F) + 1;
+
+  if (count && !codeIntact(chip8.I, count))
+    valid = false;
+}
+
+// Budget epuise : on s'arrete avant l'instruction addr
+#define STEP(addr)                                                             \
+  if (executed == budget) {                                                    \
+    c.pc = addr;                                                               \
+    return executed;                                                           \
+  }                                                                            \
+  ++executed;
+
+int Chip8Native::run(int budget) {
+  Chip8 &c = chip8;
+  int executed = 0;
+
+  while (executed < budget) {
+    if (valid) {
+      switch (c.pc) {
+)";
+
+  for (unsigned addr = begin; addr < end; ++addr) {
+    if (cfg.code[addr])
+      out << "      case " << hex(addr, 3) << ":\n        goto " << label(addr)
+          << ";\n";
+  }
+
+  out << R"(      default:
+        break;
+      }
+    }
+
+    // Hors du code traduit : interpreteur
+    {
+      uint16_t opcode = (c.readMemory(c.pc) << 8) | c.readMemory(c.pc + 1);
+      c.cycle();
+      ++executed;
+      checkStore(opcode);
+    }
+    continue;
+
+)";
+
+  for (unsigned addr = begin; addr < end; ++addr) {
+    if (!cfg.code[addr])
+      continue;
+
+    uint16_t opcode = opcodeAt(addr);
+    out << "  " << label(addr) << ": // " << hex(opcode, 4).substr(2) << "  "
+        << disassemble(opcode) << (cfg.leaders[addr] ? "  [bloc]" : "")
+        << "\n"
+        << "    STEP(" << hex(addr, 3) << ")\n";
+
+    bool fallsThrough = emitInstruction(out, addr);
+    unsigned next = addr + 2;
+
+    // Instruction suivante non emise juste apres : sortie explicite
+    bool nextEmitted = false;
+    for (unsigned a = addr + 1; a < end; ++a) {
+      if (cfg.code[a]) {
+        nextEmitted = (a == next);
+        break;
+      }
+    }
+    if (fallsThrough && !nextEmitted)
+      out << "    " << jump(next) << "\n";
+  }
+
+  out << "  }\n\n  return executed;\n}\n";
+}
+
+int main(int argc, char *argv[]) {
+  std::string input;
+  std::string output;
+
+  for (int i = 1; i < argc; ++i) {
+    std::string arg = argv[i];
+    if (arg == "-o" && i + 1 < argc) {
+      output = argv[++i];
+    } else if (input.empty()) {
+      input = arg;
+    } else {
+      input.clear();
+      break;
+    }
+  }
+
+  if (input.empty()) {
+    std::cerr << "Usage: chip8-aot <rom.ch8> [-o sortie.cpp]" << std::endl;
+    return 1;
+  }
+
+  std::ifstream file(input, std::ios::binary);
+  if (!file.is_open()) {
+    std::cerr << "Erreur: Impossible d'ouvrir le fichier " << input
+              << std::endl;
+    return 1;
+  }
+
+  std::vector<uint8_t> rom((std::istreambuf_iterator<char>(file)),
+                           std::istreambuf_iterator<char>());
+  if (rom.empty() || rom.size() > Chip8::MEMORY_SIZE - Chip8::START_ADDRESS) {
+    std::cerr << "Erreur: taille de ROM invalide" << std::endl;
+    return 1;
+  }
+
+  ControlFlow cfg = analyzeControlFlow(rom.data(), rom.size());
+
+  for (uint16_t addr : cfg.indirectJumps) {
+    std::cerr << "Saut indirect (BNNN) en " << hex(addr, 3)
+              << " : cible resolue par l'interpreteur" << std::endl;
+  }
+  for (uint16_t addr : cfg.unresolved) {
+    std::cerr << "Non resolu en " << hex(addr, 3)
+              << " : laisse a l'interpreteur" << std::endl;
+  }
+
+  std::ostringstream code;
+  Generator(rom, cfg).emit(code, fs::path(input).filename().string());
+
+  if (output.empty()) {
+    std::cout << code.str();
+  } else {
+    std::ofstream out(output);
+    if (!out.is_open()) {
+      std::cerr << "Erreur: Impossible d'ecrire " << output << std::endl;
+      return 1;
+    }
+    out << code.str();
+  }
+
+  std::cerr << cfg.code.count() << " instructions traduites" << std::endl;
+  return 0;
+}
@@ -0,0 +1,78 @@
+#include "chip8.hpp"
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <string>
+
+// chip8-bench : compare le dispatch par switch et par table sur une ROM
+
+static constexpr int CYCLES_PER_FRAME = 8; // ~500 instructions/s
+
+// Execute frames frames avec une sequence de touches deterministe et
+// renvoie la duree en secondes
+template <typename Cycle>
+static double run(Chip8 &chip8, long frames, Cycle cycle) {
+  auto start = std::chrono::steady_clock::now();
+  for (long f = 0; f < frames; ++f) {
+    int key = static_cast<int>(f / 30) % Chip8::NUM_KEYS;
+    for (int k = 0; k < Chip8::NUM_KEYS; ++k) {
+      chip8.setKey(k, k == key && (f % 30) < 10);
+    }
+    for (int i = 0; i < CYCLES_PER_FRAME; ++i) {
+      cycle(chip8);
+    }
+    chip8.updateTimers();
+  }
+  std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+  return elapsed.count();
+}
+
+static bool sameState(const Chip8 &a, const Chip8 &b) {
+  if (a.getPC() != b.getPC() || a.getI() != b.getI() ||
+      a.getSP() != b.getSP() || a.display != b.display ||
+      a.getUnknownOpcodes() != b.getUnknownOpcodes())
+    return false;
+  for (int i = 0; i < Chip8::NUM_REGISTERS; ++i) {
+    if (a.getV(i) != b.getV(i))
+      return false;
+  }
+  for (int addr = 0; addr < Chip8::MEMORY_SIZE; ++addr) {
+    if (a.peek(addr) != b.peek(addr))
+      return false;
+  }
+  return true;
+}
+
+int main(int argc, char *argv[]) {
+  if (argc < 2) {
+    std::cerr << "Usage: chip8-bench <rom.ch8> [frames]" << std::endl;
+    return 1;
+  }
+  long frames = argc > 2 ? std::stol(argv[2]) : 1000000;
+
+  Chip8 bySwitch(1);
+  Chip8 byTable(1);
+  if (!bySwitch.loadROM(argv[1]) || !byTable.loadROM(argv[1])) {
+    return 1;
+  }
+
+  double switchTime =
+      run(bySwitch, frames, [](Chip8 &c) { c.cycleSwitch(); });
+  double tableTime = run(byTable, frames, [](Chip8 &c) { c.cycleTable(); });
+
+  double instructions = static_cast<double>(frames) * CYCLES_PER_FRAME;
+  std::printf("switch : %8.2f Minstr/s\n", instructions / switchTime / 1e6);
+  std::printf("table  : %8.2f Minstr/s (x%.2f)\n",
+              instructions / tableTime / 1e6, switchTime / tableTime);
+  if (bySwitch.getUnknownOpcodes() > 0) {
+    std::printf("opcodes inconnus : %llu\n",
+                static_cast<unsigned long long>(bySwitch.getUnknownOpcodes()));
+  }
+
+  if (!sameState(bySwitch, byTable)) {
+    std::cerr << "Erreur: les deux interpreteurs divergent" << std::endl;
+    return 1;
+  }
+  return 0;
+}
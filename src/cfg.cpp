@@ -0,0 +1,98 @@
+#include "cfg.hpp"
+#include "disasm.hpp"
+
+ControlFlow analyzeControlFlow(const uint8_t *rom, size_t size) {
+  ControlFlow cfg;
+  const unsigned begin = Chip8::START_ADDRESS;
+  const unsigned end = begin + static_cast<unsigned>(size);
+
+  auto inRom = [&](unsigned addr) { return addr >= begin && addr + 1 < end; };
+  auto opcodeAt = [&](unsigned addr) {
+    return static_cast<uint16_t>((rom[addr - begin] << 8) |
+                                 rom[addr - begin + 1]);
+  };
+
+  std::vector<unsigned> work{begin};
+  std::bitset<Chip8::MEMORY_SIZE> seen;
+  cfg.leaders[begin] = true;
+
+  // Ajoute une cible de branchement et la marque comme debut de bloc
+  auto branch = [&](unsigned from, unsigned target) {
+    if (!inRom(target)) {
+      cfg.unresolved.push_back(static_cast<uint16_t>(from));
+      return;
+    }
+    cfg.leaders[target] = true;
+    work.push_back(target);
+  };
+
+  while (!work.empty()) {
+    unsigned addr = work.back();
+    work.pop_back();
+
+    // Parcours lineaire jusqu'a une rupture de flot
+    while (true) {
+      if (!inRom(addr)) {
+        cfg.unresolved.push_back(static_cast<uint16_t>(addr));
+        break;
+      }
+      if (seen[addr])
+        break;
+
+      uint16_t opcode = opcodeAt(addr);
+      if (!isValidOpcode(opcode)) {
+        cfg.unresolved.push_back(static_cast<uint16_t>(addr));
+        break;
+      }
+
+      seen[addr] = true;
+      cfg.code[addr] = true;
+
+      unsigned next = addr + 2;
+      uint16_t nnn = opcode & 0x0FFF;
+      uint8_t nn = opcode & 0xFF;
+      bool stop = false;
+
+      switch (opcode & 0xF000) {
+      case 0x0000:
+        if (opcode == 0x00EE) // RET : la cible vient de la pile
+          stop = true;
+        break;
+      case 0x1000:
+        branch(addr, nnn);
+        stop = true;
+        break;
+      case 0x2000:
+        branch(addr, nnn);
+        branch(addr, next); // Adresse de retour
+        stop = true;
+        break;
+      case 0x3000:
+      case 0x4000:
+      case 0x5000:
+      case 0x9000:
+        branch(addr, next);
+        branch(addr, next + 2);
+        stop = true;
+        break;
+      case 0xB000:
+        cfg.indirectJumps.push_back(static_cast<uint16_t>(addr));
+        stop = true;
+        break;
+      case 0xE000:
+        if (nn == 0x9E || nn == 0xA1) {
+          branch(addr, next);
+          branch(addr, next + 2);
+          stop = true;
+        }
+        break;
+      }
+
+      if (stop)
+        break;
+      addr = next;
+    }
+  }
+
+  return cfg;
+}
@@ -0,0 +1,26 @@
+#ifndef CFG_HPP
+#define CFG_HPP
+
+#include "chip8.hpp"
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Graphe de controle d'une ROM, reconstruit depuis START_ADDRESS
+struct ControlFlow {
+  // Adresses (premier octet) des instructions atteignables
+  std::bitset<Chip8::MEMORY_SIZE> code;
+  // Debuts de blocs de base
+  std::bitset<Chip8::MEMORY_SIZE> leaders;
+  // Sauts indirects BNNN : cible connue seulement a l'execution
+  std::vector<uint16_t> indirectJumps;
+  // Chemins abandonnes : opcode inconnu ou cible hors de la ROM
+  std::vector<uint16_t> unresolved;
+};
+
+// Analyse statique d'une ROM chargee en START_ADDRESS. Les appels 2NNN
+// continuent a l'adresse de retour ; 00EE termine le chemin.
+ControlFlow analyzeControlFlow(const uint8_t *rom, size_t size);
+
+#endif // CFG_HPP
@@ -1,4 +1,5 @@
 #include "chip8.hpp"
+#include "latency.hpp"
 #include <cstring>
 #include <fstream>
 #include <iostream>
@@ -23,7 +24,9 @@ constexpr uint8_t FONTSET[80] = {
     0xF0, 0x80, 0xF0, 0x80, 0x80  // F
 };
 
-Chip8::Chip8() : rng(std::random_device{}()), randByte(0, 255) { initialize(); }
+Chip8::Chip8() : Chip8(std::random_device{}()) {}
+
+Chip8::Chip8(uint32_t seed) : rng(seed), randByte(0, 255) { initialize(); }
 
 void Chip8::initialize() {
   pc = START_ADDRESS;
@@ -32,6 +35,8 @@ void Chip8::initialize() {
   delayTimer = 0;
   soundTimer = 0;
   drawFlag = false;
+  unknownOpcodes = 0;
+  romSize = 0;
 
   // Vider la mémoire, les registres, l'écran, etc.
   memory.fill(0);
@@ -45,9 +50,7 @@ void Chip8::initialize() {
 }
 
 void Chip8::loadFontset() {
-  for (size_t i = 0; i < 80; ++i) {
-    memory[FONTSET_START + i] = FONTSET[i];
-  }
+  memory.write(FONTSET_START, FONTSET, sizeof(FONTSET));
 }
 
 bool Chip8::loadROM(const std::string &filename) {
@@ -67,17 +70,38 @@ bool Chip8::loadROM(const std::string &filename) {
     return false;
   }
 
-  file.read(reinterpret_cast<char *>(&memory[START_ADDRESS]), size);
+  std::array<uint8_t, MEMORY_SIZE - START_ADDRESS> buffer;
+  file.read(reinterpret_cast<char *>(buffer.data()), size);
   file.close();
+  memory.write(START_ADDRESS, buffer.data(), size);
+  romSize = static_cast<uint16_t>(size);
 
   std::cout << "ROM chargée: " << filename << " (" << size << " bytes)"
             << std::endl;
   return true;
 }
 
+bool Chip8::loadROM(const uint8_t *data, size_t size) {
+  if (size > static_cast<size_t>(MEMORY_SIZE - START_ADDRESS)) {
+    return false;
+  }
+
+  memory.write(START_ADDRESS, data, size);
+  romSize = static_cast<uint16_t>(size);
+  return true;
+}
+
 void Chip8::cycle() {
+#ifdef CHIP8_TABLE_DISPATCH
+  cycleTable();
+#else
+  cycleSwitch();
+#endif
+}
+
+void Chip8::cycleSwitch() {
   // Fetch: lire l'opcode (2 bytes, big-endian)
-  uint16_t opcode = (memory[pc] << 8) | memory[pc + 1];
+  uint16_t opcode = (readMemory(pc) << 8) | readMemory(pc + 1);
 
   // Incrémenter PC avant l'exécution
   pc += 2;
@@ -86,6 +110,13 @@ void Chip8::cycle() {
   executeOpcode(opcode);
 }
 
+void Chip8::runFrame(int instructionsPerFrame) {
+  for (int i = 0; i < instructionsPerFrame; ++i) {
+    cycle();
+  }
+  updateTimers();
+}
+
 void Chip8::updateTimers() {
   if (delayTimer > 0) {
     --delayTimer;
@@ -100,6 +131,9 @@ void Chip8::updateTimers() {
 
 void Chip8::setKey(int key, bool pressed) {
   if (key >= 0 && key < NUM_KEYS) {
+    if (latency && keypad[key] != (pressed ? 1 : 0)) {
+      latency->onSetKey(key);
+    }
     keypad[key] = pressed ? 1 : 0;
   }
 }
@@ -130,6 +164,9 @@ void Chip8::executeOpcode(uint16_t opcode) {
       --sp;
       pc = stack[sp];
       break;
+    default: // SYS addr : ignoré
+      ++unknownOpcodes;
+      break;
     }
     break;
 
@@ -173,12 +210,18 @@ void Chip8::executeOpcode(uint16_t opcode) {
       break; // LD Vx, Vy
     case 0x1:
       V[x] |= V[y];
+      if (quirks.vfReset)
+        V[0xF] = 0;
       break; // OR Vx, Vy
     case 0x2:
       V[x] &= V[y];
+      if (quirks.vfReset)
+        V[0xF] = 0;
       break; // AND Vx, Vy
     case 0x3:
       V[x] ^= V[y];
+      if (quirks.vfReset)
+        V[0xF] = 0;
       break;    // XOR Vx, Vy
     case 0x4: { // ADD Vx, Vy
       uint16_t sum = V[x] + V[y];
@@ -192,6 +235,8 @@ void Chip8::executeOpcode(uint16_t opcode) {
       break;
     }
     case 0x6: { // SHR Vx
+      if (quirks.shiftUsesVy)
+        V[x] = V[y];
       V[0xF] = V[x] & 0x1;
       V[x] >>= 1;
       break;
@@ -202,10 +247,15 @@ void Chip8::executeOpcode(uint16_t opcode) {
       break;
     }
     case 0xE: { // SHL Vx
+      if (quirks.shiftUsesVy)
+        V[x] = V[y];
       V[0xF] = (V[x] >> 7) & 0x1;
       V[x] <<= 1;
       break;
     }
+    default:
+      ++unknownOpcodes;
+      break;
     }
     break;
 
@@ -218,8 +268,8 @@ void Chip8::executeOpcode(uint16_t opcode) {
     I = nnn;
     break;
 
-  case 0xB000: // JP V0, addr - Jump to V0 + nnn
-    pc = V[0] + nnn;
+  case 0xB000: // JP V0, addr - Jump to V0 + nnn (ou Vx + xnn)
+    pc = V[quirks.jumpUsesVx ? x : 0] + nnn;
     break;
 
   case 0xC000: // RND Vx, byte - Set Vx = random AND nn
@@ -230,29 +280,36 @@ void Chip8::executeOpcode(uint16_t opcode) {
     uint8_t xPos = V[x] % DISPLAY_WIDTH;
     uint8_t yPos = V[y] % DISPLAY_HEIGHT;
     V[0xF] = 0;
+    uint8_t *pixels = display.mutableData();
 
     for (unsigned int row = 0; row < n; ++row) {
-      uint8_t spriteByte = memory[I + row];
+      uint8_t spriteByte = readMemory(I + row);
 
       for (unsigned int col = 0; col < 8; ++col) {
         uint8_t spritePixel = (spriteByte >> (7 - col)) & 0x1;
         uint32_t screenX = (xPos + col) % DISPLAY_WIDTH;
         uint32_t screenY = (yPos + row) % DISPLAY_HEIGHT;
         uint32_t idx = screenY * DISPLAY_WIDTH + screenX;
+        bool clipped = quirks.clipSprites && (xPos + col >= DISPLAY_WIDTH ||
+                                              yPos + row >= DISPLAY_HEIGHT);
 
-        if (spritePixel) {
-          if (display[idx]) {
+        if (spritePixel && !clipped) {
+          if (pixels[idx]) {
             V[0xF] = 1; // Collision
           }
-          display[idx] ^= 1;
+          pixels[idx] ^= 1;
         }
       }
     }
     drawFlag = true;
+    if (latency)
+      latency->onDraw();
     break;
   }
 
   case 0xE000:
+    if (latency)
+      latency->onKeyRead(V[x]);
     switch (nn) {
     case 0x9E: // SKP Vx - Skip if key Vx is pressed
       if (keypad[V[x]])
@@ -262,6 +319,9 @@ void Chip8::executeOpcode(uint16_t opcode) {
       if (!keypad[V[x]])
         pc += 2;
       break;
+    default:
+      ++unknownOpcodes;
+      break;
     }
     break;
 
@@ -271,6 +331,8 @@ void Chip8::executeOpcode(uint16_t opcode) {
       V[x] = delayTimer;
       break;     // LD Vx, DT
     case 0x0A: { // LD Vx, K - Wait for key
+      if (latency)
+        latency->onKeyRead(-1);
       bool keyPressed = false;
       for (int i = 0; i < NUM_KEYS; ++i) {
         if (keypad[i]) {
@@ -296,28 +358,31 @@ void Chip8::executeOpcode(uint16_t opcode) {
       I = FONTSET_START + (V[x] * 5);
       break;     // LD F, Vx
     case 0x33: { // LD B, Vx - BCD
-      memory[I] = V[x] / 100;
-      memory[I + 1] = (V[x] / 10) % 10;
-      memory[I + 2] = V[x] % 10;
+      writeMemory(I, V[x] / 100);
+      writeMemory(I + 1, (V[x] / 10) % 10);
+      writeMemory(I + 2, V[x] % 10);
       break;
     }
     case 0x55: { // LD [I], Vx
       for (int i = 0; i <= x; ++i) {
-        memory[I + i] = V[i];
+        writeMemory(I + i, V[i]);
       }
+      if (quirks.memoryIncrementsI)
+        I += x + 1;
       break;
     }
     case 0x65: { // LD Vx, [I]
       for (int i = 0; i <= x; ++i) {
-        V[i] = memory[I + i];
+        V[i] = readMemory(I + i);
       }
+      if (quirks.memoryIncrementsI)
+        I += x + 1;
       break;
     }
+    default:
+      ++unknownOpcodes;
+      break;
     }
     break;
-
-  default:
-    std::cerr << "Opcode inconnu: 0x" << std::hex << opcode << std::endl;
-    break;
   }
 }
@@ -1,11 +1,15 @@
 #ifndef CHIP8_HPP
 #define CHIP8_HPP
 
+#include "cow_buffer.hpp"
+#include <cstddef>
 #include <cstdint>
 #include <string>
 #include <array>
 #include <random>
 
+class LatencyTracker;
+
 class Chip8 {
 public:
     // Constantes
@@ -17,27 +21,101 @@ public:
     static constexpr int DISPLAY_HEIGHT = 32;
     static constexpr uint16_t START_ADDRESS = 0x200;
     static constexpr uint16_t FONTSET_START = 0x50;
+    static constexpr int PAGE_SIZE = 256;
+
+    // Mémoire et écran en pages copie-sur-écriture (voir fork())
+    using Memory = CowBuffer<MEMORY_SIZE, PAGE_SIZE>;
+    using FrameBuffer = CowBuffer<DISPLAY_WIDTH * DISPLAY_HEIGHT,
+                                  DISPLAY_WIDTH * DISPLAY_HEIGHT>;
 
     // État public pour l'affichage
-    std::array<uint8_t, DISPLAY_WIDTH * DISPLAY_HEIGHT> display{};
+    FrameBuffer display;
     bool drawFlag = false;
 
-    // Constructeur
+    // Constructeurs (graine fixe pour des exécutions reproductibles)
     Chip8();
+    explicit Chip8(uint32_t seed);
 
     // Méthodes principales
     void initialize();
     bool loadROM(const std::string& filename);
+    bool loadROM(const uint8_t* data, size_t size);
     void cycle();
     void updateTimers();
 
+    // Interpréteurs appelés par cycle() : switch par défaut, table de
+    // dispatch avec CHIP8_TABLE_DISPATCH (chip8-bench compare les deux)
+    void cycleSwitch();
+#ifdef CHIP8_TABLE_DISPATCH
+    void cycleTable();
+#endif
+
+    // Exécute une frame (1/60 s) : n instructions puis les timers
+    void runFrame(int instructionsPerFrame);
+
+    // Copie légère pour l'exploration : seuls les registres sont copiés,
+    // la mémoire et l'écran sont partagés jusqu'à la première écriture.
+    // Le tracker de latence est aussi partagé.
+    Chip8 fork() const { return *this; }
+
+    // fork() pour l'exécution spéculative (run-ahead) : sans tracker de
+    // latence, les frames calculées d'avance ne sont pas instrumentées
+    Chip8 forkSpeculative() const {
+        Chip8 copy(*this);
+        copy.latency = nullptr;
+        return copy;
+    }
+
     // Input
     void setKey(int key, bool pressed);
     bool isKeyPressed(int key) const;
 
+    // Lecture de l'état (debugger, outils)
+    uint16_t getPC() const { return pc; }
+    uint16_t getI() const { return I; }
+    uint8_t getSP() const { return sp; }
+    uint8_t getV(int reg) const { return V[reg]; }
+    uint16_t getStack(int level) const { return stack[level]; }
+    uint8_t getDelayTimer() const { return delayTimer; }
+    uint8_t getSoundTimer() const { return soundTimer; }
+    uint8_t peek(uint16_t addr) const { return readMemory(addr); }
+    size_t getRomSize() const { return romSize; }
+
+    // Opcodes inconnus exécutés (comme des NOP) depuis initialize()
+    uint64_t getUnknownOpcodes() const { return unknownOpcodes; }
+
+    // Variantes de comportement des interpréteurs d'origine. Les valeurs
+    // par défaut sont celles de cet émulateur ; initialize() les conserve.
+    struct Quirks {
+        bool vfReset = false;           // 8XY1/2/3 remettent VF à 0
+        bool shiftUsesVy = false;       // 8XY6/8XYE décalent Vy dans Vx
+        bool memoryIncrementsI = false; // FX55/FX65 avancent I
+        bool jumpUsesVx = false;        // BXNN saute à Vx + XNN
+        bool clipSprites = false;       // DXYN coupe au bord de l'écran
+    };
+    void setQuirks(const Quirks& q) { quirks = q; }
+    const Quirks& getQuirks() const { return quirks; }
+
+    // Instrumentation de latence (nullptr = désactivée)
+    void setLatencyTracker(LatencyTracker* tracker) { latency = tracker; }
+
 private:
+    // Code natif généré par chip8-aot (voir chip8_native.hpp)
+    friend class Chip8Native;
+    // Handlers de la table de dispatch (dispatch.cpp)
+    friend struct OpcodeTable;
+
     // Mémoire et registres
-    std::array<uint8_t, MEMORY_SIZE> memory{};
+    Memory memory;
+
+    // Accès mémoire des instructions : l'adresse boucle sur 4 Ko (I
+    // poussé au-delà de 0xFFF par FX1E, FX55 en fin de mémoire, PC = 0xFFF)
+    uint8_t readMemory(unsigned addr) const {
+        return memory[addr & (MEMORY_SIZE - 1)];
+    }
+    void writeMemory(unsigned addr, uint8_t value) {
+        memory.set(addr & (MEMORY_SIZE - 1), value);
+    }
     std::array<uint8_t, NUM_REGISTERS> V{};  // Registres V0-VF
     uint16_t I = 0;                           // Registre Index
     uint16_t pc = START_ADDRESS;              // Program Counter
@@ -53,8 +131,14 @@ private:
     // Input
     std::array<uint8_t, NUM_KEYS> keypad{};
 
-    // Random
-    std::mt19937 rng;
+    // Instrumentation
+    LatencyTracker* latency = nullptr;
+    uint64_t unknownOpcodes = 0;
+    uint16_t romSize = 0;
+    Quirks quirks;
+
+    // Random (état de 8 octets : un fork reste léger)
+    std::minstd_rand rng;
     std::uniform_int_distribution<uint8_t> randByte;
 
     // Fontset
@@ -0,0 +1,76 @@
+#include "chip8_api.h"
+#include "chip8.hpp"
+#include "timing.hpp"
+#include <new>
+#include <vector>
+
+struct chip8_handle {
+  explicit chip8_handle(uint32_t seed) : chip8(seed) {}
+
+  Chip8 chip8;
+  std::vector<uint8_t> rom;
+  int cyclesPerFrame = 500 / 60;
+  bool vipTiming = false;
+  int cycleCredit = 0;
+};
+
+chip8_handle *chip8_create(uint32_t seed) {
+  return new (std::nothrow) chip8_handle(seed);
+}
+
+void chip8_destroy(chip8_handle *handle) { delete handle; }
+
+int chip8_load_rom(chip8_handle *handle, const uint8_t *data, size_t size) {
+  handle->chip8.initialize();
+  if (!handle->chip8.loadROM(data, size)) {
+    return -1;
+  }
+  handle->rom.assign(data, data + size);
+  return 0;
+}
+
+void chip8_reset(chip8_handle *handle) {
+  handle->cycleCredit = 0;
+  handle->chip8.initialize();
+  handle->chip8.loadROM(handle->rom.data(), handle->rom.size());
+}
+
+void chip8_set_cycles_per_frame(chip8_handle *handle, int cycles) {
+  if (cycles > 0) {
+    handle->cyclesPerFrame = cycles;
+  }
+}
+
+void chip8_set_vip_timing(chip8_handle *handle, int enabled) {
+  handle->vipTiming = enabled != 0;
+  handle->cycleCredit = 0;
+}
+
+const uint8_t *chip8_step_frames(chip8_handle *handle, int n,
+                                 const uint8_t *keys) {
+  Chip8 &chip8 = handle->chip8;
+
+  if (keys) {
+    for (int i = 0; i < Chip8::NUM_KEYS; ++i) {
+      chip8.setKey(i, keys[i] != 0);
+    }
+  }
+
+  for (int frame = 0; frame < n; ++frame) {
+    if (handle->vipTiming) {
+      vip::runFrame(chip8, handle->cycleCredit, [&chip8] {
+        chip8.cycle();
+        return true;
+      });
+      chip8.updateTimers();
+    } else {
+      chip8.runFrame(handle->cyclesPerFrame);
+    }
+  }
+
+  return chip8.display.data();
+}
+
+const uint8_t *chip8_framebuffer(const chip8_handle *handle) {
+  return handle->chip8.display.data();
+}
@@ -0,0 +1,73 @@
+#ifndef CHIP8_API_H
+#define CHIP8_API_H
+
+/*
+ * API C du coeur CHIP-8 (bibliotheque chip8core, sans SDL2).
+ *
+ * Pensee pour l'embarquement (FFI, bancs de test) : un appel fait avancer
+ * l'emulateur de plusieurs frames et renvoie directement le framebuffer
+ * interne (64x32 octets, 0 ou 1), sans copie. Le pointeur reste valide
+ * jusqu'a chip8_destroy().
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(_WIN32) && defined(CHIP8CORE_SHARED)
+#ifdef CHIP8CORE_EXPORTS
+#define CHIP8_API __declspec(dllexport)
+#else
+#define CHIP8_API __declspec(dllimport)
+#endif
+#elif defined(__GNUC__)
+#define CHIP8_API __attribute__((visibility("default")))
+#else
+#define CHIP8_API
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define CHIP8_DISPLAY_WIDTH 64
+#define CHIP8_DISPLAY_HEIGHT 32
+#define CHIP8_NUM_KEYS 16
+
+typedef struct chip8_handle chip8_handle;
+
+/* Cree une instance ; la graine fixe le generateur de CXNN. */
+CHIP8_API chip8_handle *chip8_create(uint32_t seed);
+CHIP8_API void chip8_destroy(chip8_handle *handle);
+
+/* Charge une ROM depuis un buffer. Retourne 0 en cas de succes. */
+CHIP8_API int chip8_load_rom(chip8_handle *handle, const uint8_t *data,
+                             size_t size);
+
+/* Remet la machine a zero et recharge la derniere ROM. */
+CHIP8_API void chip8_reset(chip8_handle *handle);
+
+/* Instructions executees par frame (defaut : 500 Hz / 60). */
+CHIP8_API void chip8_set_cycles_per_frame(chip8_handle *handle, int cycles);
+
+/*
+ * Active (1) ou non (0) le modele de timing du COSMAC VIP : chaque frame
+ * recoit un budget de temps emule au lieu d'un nombre d'instructions.
+ */
+CHIP8_API void chip8_set_vip_timing(chip8_handle *handle, int enabled);
+
+/*
+ * Execute n frames. keys pointe sur CHIP8_NUM_KEYS octets (non nul =
+ * appuye) ou vaut NULL pour garder l'etat precedent du clavier.
+ * Retourne le framebuffer (CHIP8_DISPLAY_WIDTH * CHIP8_DISPLAY_HEIGHT).
+ */
+CHIP8_API const uint8_t *chip8_step_frames(chip8_handle *handle, int n,
+                                           const uint8_t *keys);
+
+/* Framebuffer courant, sans executer d'instruction. */
+CHIP8_API const uint8_t *chip8_framebuffer(const chip8_handle *handle);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CHIP8_API_H */
@@ -0,0 +1,39 @@
+#ifndef CHIP8_NATIVE_HPP
+#define CHIP8_NATIVE_HPP
+
+#include "chip8.hpp"
+#include <cstddef>
+#include <cstdint>
+
+// ROM recompilee en C++ par chip8-aot. Les fonctions membres sont definies
+// dans la traduction generee ; une seule ROM par executable.
+class Chip8Native {
+public:
+  explicit Chip8Native(Chip8 &chip8) : chip8(chip8) { reset(); }
+
+  // Execute au plus budget instructions (natif ou interprete), retourne
+  // le nombre execute
+  int run(int budget);
+
+  // A appeler apres chaque chargement de ROM : le code natif n'est utilise
+  // que si la memoire contient bien la ROM traduite
+  void reset();
+
+  bool isValid() const { return valid; }
+
+  // ROM embarquee
+  static const uint8_t ROM[];
+  static const size_t ROM_SIZE;
+  static const char *const ROM_NAME;
+
+private:
+  Chip8 &chip8;
+  bool valid = false;
+
+  // Vrai si [first, first + count) ne modifie pas le code traduit
+  bool codeIntact(unsigned first, unsigned count) const;
+  // Verifie une ecriture FX33/FX55 executee par l'interpreteur
+  void checkStore(uint16_t opcode);
+};
+
+#endif // CHIP8_NATIVE_HPP
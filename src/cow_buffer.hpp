@@ -0,0 +1,177 @@
+#ifndef COW_BUFFER_HPP
+#define COW_BUFFER_HPP
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+// Buffer decoupe en pages partagees par comptage de references et copiees
+// a la premiere ecriture. Copier un CowBuffer ne copie que les pointeurs.
+// Les pages liberees retournent dans un pool par thread.
+template <size_t Size, size_t PageSize> class CowBuffer {
+  static_assert(Size % PageSize == 0, "Size doit etre un multiple de PageSize");
+
+public:
+  static constexpr size_t NUM_PAGES = Size / PageSize;
+
+  CowBuffer() {
+    for (auto &page : pages) {
+      page = allocate();
+      std::memset(page->bytes, 0, PageSize);
+    }
+  }
+
+  CowBuffer(const CowBuffer &other) {
+    for (size_t i = 0; i < NUM_PAGES; ++i) {
+      pages[i] = retain(other.pages[i]);
+    }
+  }
+
+  CowBuffer &operator=(const CowBuffer &other) {
+    for (size_t i = 0; i < NUM_PAGES; ++i) {
+      Page *page = retain(other.pages[i]);
+      release(pages[i]);
+      pages[i] = page;
+    }
+    return *this;
+  }
+
+  ~CowBuffer() {
+    for (auto page : pages) {
+      release(page);
+    }
+  }
+
+  uint8_t operator[](size_t i) const {
+    assert(i < Size);
+    return pages[i / PageSize]->bytes[i % PageSize];
+  }
+
+  void set(size_t i, uint8_t value) {
+    assert(i < Size);
+    writablePage(i / PageSize)[i % PageSize] = value;
+  }
+
+  void write(size_t offset, const uint8_t *src, size_t len) {
+    while (len > 0) {
+      size_t chunk = PageSize - offset % PageSize;
+      if (chunk > len)
+        chunk = len;
+      std::memcpy(writablePage(offset / PageSize) + offset % PageSize, src,
+                  chunk);
+      offset += chunk;
+      src += chunk;
+      len -= chunk;
+    }
+  }
+
+  void fill(uint8_t value) {
+    for (auto &page : pages) {
+      // Page partagee : inutile de copier un contenu qu'on ecrase
+      if (page->refs.load(std::memory_order_acquire) != 1) {
+        release(page);
+        page = allocate();
+      }
+      std::memset(page->bytes, value, PageSize);
+    }
+  }
+
+  // Page modifiable (copiee si partagee)
+  uint8_t *writablePage(size_t index) {
+    Page *&page = pages[index];
+    if (page->refs.load(std::memory_order_acquire) != 1) {
+      Page *copy = allocate();
+      std::memcpy(copy->bytes, page->bytes, PageSize);
+      release(page);
+      page = copy;
+    }
+    return page->bytes;
+  }
+
+  // Acces contigu, pour un buffer d'une seule page
+  const uint8_t *data() const {
+    static_assert(NUM_PAGES == 1, "data() exige une seule page");
+    return pages[0]->bytes;
+  }
+
+  uint8_t *mutableData() {
+    static_assert(NUM_PAGES == 1, "mutableData() exige une seule page");
+    return writablePage(0);
+  }
+
+  bool operator==(const CowBuffer &other) const {
+    for (size_t i = 0; i < NUM_PAGES; ++i) {
+      if (pages[i] != other.pages[i] &&
+          std::memcmp(pages[i]->bytes, other.pages[i]->bytes, PageSize) != 0)
+        return false;
+    }
+    return true;
+  }
+
+  bool operator!=(const CowBuffer &other) const { return !(*this == other); }
+
+private:
+  struct Page {
+    std::atomic<uint32_t> refs{1};
+    uint8_t bytes[PageSize];
+  };
+
+  // Pool de pages libres propre a chaque thread
+  struct Pool {
+    static constexpr size_t MAX_FREE = 4096;
+    std::vector<Page *> free;
+
+    ~Pool() {
+      for (auto page : free) {
+        delete page;
+      }
+      destroyed() = true;
+    }
+
+    // Buffers detruits apres le pool (fin de thread) : allocation directe
+    static bool &destroyed() {
+      thread_local bool flag = false;
+      return flag;
+    }
+  };
+
+  static Pool *pool() {
+    if (Pool::destroyed())
+      return nullptr;
+    thread_local Pool instance;
+    return &instance;
+  }
+
+  static Page *allocate() {
+    Pool *p = pool();
+    if (!p || p->free.empty()) {
+      return new Page;
+    }
+    Page *page = p->free.back();
+    p->free.pop_back();
+    page->refs.store(1, std::memory_order_relaxed);
+    return page;
+  }
+
+  static Page *retain(Page *page) {
+    page->refs.fetch_add(1, std::memory_order_relaxed);
+    return page;
+  }
+
+  static void release(Page *page) {
+    if (page->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      Pool *p = pool();
+      if (p && p->free.size() < Pool::MAX_FREE)
+        p->free.push_back(page);
+      else
+        delete page;
+    }
+  }
+
+  Page *pages[NUM_PAGES];
+};
+
+#endif // COW_BUFFER_HPP
@@ -0,0 +1,113 @@
+#include "debug_view.hpp"
+#include "disasm.hpp"
+#include "text.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <iostream>
+
+DebugView::DebugView() {}
+
+DebugView::~DebugView() { cleanup(); }
+
+bool DebugView::init() {
+  if (window) {
+    return true;
+  }
+
+  window = SDL_CreateWindow("CHIP-8 Debugger", SDL_WINDOWPOS_CENTERED,
+                            SDL_WINDOWPOS_CENTERED, WIDTH, HEIGHT,
+                            SDL_WINDOW_HIDDEN);
+  if (!window) {
+    std::cerr << "Debug Window Error: " << SDL_GetError() << std::endl;
+    return false;
+  }
+
+  renderer = SDL_CreateRenderer(window, -1, SDL_RENDERER_ACCELERATED);
+  if (!renderer) {
+    std::cerr << "Debug Renderer Error: " << SDL_GetError() << std::endl;
+    return false;
+  }
+
+  return true;
+}
+
+void DebugView::cleanup() {
+  if (renderer) {
+    SDL_DestroyRenderer(renderer);
+    renderer = nullptr;
+  }
+  if (window) {
+    SDL_DestroyWindow(window);
+    window = nullptr;
+  }
+}
+
+void DebugView::setVisible(bool visible) {
+  this->visible = visible;
+  if (!window)
+    return;
+  if (visible)
+    SDL_ShowWindow(window);
+  else
+    SDL_HideWindow(window);
+}
+
+void DebugView::render(const Chip8 &chip8, const Debugger &debugger,
+                       const std::string &status) {
+  if (!visible || !renderer)
+    return;
+
+  SDL_SetRenderDrawColor(renderer, 15, 15, 30, 255);
+  SDL_RenderClear(renderer);
+
+  char line[64];
+  uint16_t pc = chip8.getPC();
+
+  // Desassemblage : quelques instructions avant PC, puis la suite
+  int addr = pc >= 8 ? pc - 8 : pc % 2;
+  for (int i = 0; i < LINES; ++i, addr += 2) {
+    if (addr + 1 >= Chip8::MEMORY_SIZE)
+      break;
+
+    uint16_t opcode = (chip8.peek(addr) << 8) | chip8.peek(addr + 1);
+    std::snprintf(line, sizeof(line), "%c%c%03X %04X %s",
+                  debugger.hasBreakpoint(addr) ? '*' : ' ',
+                  addr == pc ? '>' : ' ', addr, opcode,
+                  disassemble(opcode).c_str());
+
+    if (addr == pc)
+      SDL_SetRenderDrawColor(renderer, 255, 255, 0, 255);
+    else
+      SDL_SetRenderDrawColor(renderer, 180, 180, 180, 255);
+    renderText(renderer, line, 10, 10 + i * 18, 2);
+  }
+
+  // Registres
+  SDL_SetRenderDrawColor(renderer, 120, 200, 255, 255);
+  for (int r = 0; r < Chip8::NUM_REGISTERS; r += 2) {
+    std::snprintf(line, sizeof(line), "V%X=%02X V%X=%02X", r, chip8.getV(r),
+                  r + 1, chip8.getV(r + 1));
+    renderText(renderer, line, 420, 10 + (r / 2) * 18, 2);
+  }
+
+  std::snprintf(line, sizeof(line), "I=%03X SP=%X", chip8.getI(),
+                chip8.getSP());
+  renderText(renderer, line, 420, 10 + 8 * 18, 2);
+  std::snprintf(line, sizeof(line), "DT=%02X ST=%02X", chip8.getDelayTimer(),
+                chip8.getSoundTimer());
+  renderText(renderer, line, 420, 10 + 9 * 18, 2);
+
+  // Pile (du plus recent au plus ancien)
+  int top = std::min<int>(chip8.getSP(), Chip8::STACK_SIZE);
+  for (int level = top - 1, row = 10; level >= 0 && row < LINES;
+       --level, ++row) {
+    std::snprintf(line, sizeof(line), "S%X=%03X", level,
+                  chip8.getStack(level));
+    renderText(renderer, line, 420, 10 + row * 18, 2);
+  }
+
+  SDL_SetRenderDrawColor(renderer, 255, 120, 120, 255);
+  renderText(renderer, status, 10, HEIGHT - 24, 2);
+
+  SDL_RenderPresent(renderer);
+}
@@ -0,0 +1,32 @@
+#ifndef DEBUG_VIEW_HPP
+#define DEBUG_VIEW_HPP
+
+#include "chip8.hpp"
+#include "debugger.hpp"
+#include <SDL2/SDL.h>
+#include <string>
+
+// Fenetre annexe du debugger : desassemblage autour de PC et registres
+class DebugView {
+public:
+  DebugView();
+  ~DebugView();
+
+  bool init();
+  void cleanup();
+  void setVisible(bool visible);
+  bool isVisible() const { return visible; }
+  void render(const Chip8 &chip8, const Debugger &debugger,
+              const std::string &status);
+
+private:
+  SDL_Window *window = nullptr;
+  SDL_Renderer *renderer = nullptr;
+  bool visible = false;
+
+  static constexpr int WIDTH = 640;
+  static constexpr int HEIGHT = 360;
+  static constexpr int LINES = 16;
+};
+
+#endif // DEBUG_VIEW_HPP
@@ -0,0 +1,216 @@
+#include "debugger.hpp"
+#include "disasm.hpp"
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+
+Debugger::Debugger(Chip8 &chip8) : chip8(chip8) {}
+
+void Debugger::setBreakpoint(uint16_t addr, bool enabled) {
+  breakpoints[addr % Chip8::MEMORY_SIZE] = enabled;
+}
+
+void Debugger::toggleBreakpoint(uint16_t addr) {
+  breakpoints.flip(addr % Chip8::MEMORY_SIZE);
+}
+
+bool Debugger::hasBreakpoint(uint16_t addr) const {
+  return breakpoints[addr % Chip8::MEMORY_SIZE];
+}
+
+void Debugger::watchMemory(uint16_t first, uint16_t last) {
+  for (unsigned a = first; a <= last && a < Chip8::MEMORY_SIZE; ++a) {
+    memoryWatch[a] = true;
+  }
+}
+
+void Debugger::watchIndex(uint16_t first, uint16_t last) {
+  for (unsigned a = first; a <= last && a < Chip8::MEMORY_SIZE; ++a) {
+    indexWatch[a] = true;
+  }
+}
+
+bool Debugger::addCondition(const std::string &expr) {
+  // Forme: <operande> <comparateur> <valeur>, espaces optionnels
+  std::string s;
+  for (char c : expr) {
+    if (!std::isspace(static_cast<unsigned char>(c)))
+      s += static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+  }
+
+  Condition cond{expr, Operand::V, 0, Compare::Eq, 0, false};
+  size_t pos = 0;
+
+  if (s.size() >= 2 && s[0] == 'V' && std::isxdigit(s[1])) {
+    cond.operand = Operand::V;
+    cond.reg = std::strtol(s.substr(1, 1).c_str(), nullptr, 16);
+    pos = 2;
+  } else if (s.compare(0, 2, "SP") == 0) {
+    cond.operand = Operand::SP;
+    pos = 2;
+  } else if (s.compare(0, 2, "DT") == 0) {
+    cond.operand = Operand::DT;
+    pos = 2;
+  } else if (s.compare(0, 2, "ST") == 0) {
+    cond.operand = Operand::ST;
+    pos = 2;
+  } else if (s.compare(0, 1, "I") == 0) {
+    cond.operand = Operand::I;
+    pos = 1;
+  } else {
+    return false;
+  }
+
+  static const struct {
+    const char *text;
+    Compare compare;
+  } OPS[] = {{"==", Compare::Eq}, {"!=", Compare::Ne}, {"<=", Compare::Le},
+             {">=", Compare::Ge}, {"<", Compare::Lt},  {">", Compare::Gt}};
+
+  bool found = false;
+  for (const auto &op : OPS) {
+    size_t len = std::char_traits<char>::length(op.text);
+    if (s.compare(pos, len, op.text) == 0) {
+      cond.compare = op.compare;
+      pos += len;
+      found = true;
+      break;
+    }
+  }
+  if (!found || pos >= s.size())
+    return false;
+
+  // Valeur decimale ou hexadecimale (0x..)
+  char *end = nullptr;
+  cond.value = std::strtoul(s.c_str() + pos, &end, 0);
+  if (*end != '\0')
+    return false;
+
+  cond.wasTrue = evaluate(cond);
+  conditions.push_back(cond);
+  return true;
+}
+
+bool Debugger::evaluate(const Condition &cond) const {
+  unsigned lhs = 0;
+  switch (cond.operand) {
+  case Operand::V:
+    lhs = chip8.getV(cond.reg);
+    break;
+  case Operand::I:
+    lhs = chip8.getI();
+    break;
+  case Operand::SP:
+    lhs = chip8.getSP();
+    break;
+  case Operand::DT:
+    lhs = chip8.getDelayTimer();
+    break;
+  case Operand::ST:
+    lhs = chip8.getSoundTimer();
+    break;
+  }
+
+  switch (cond.compare) {
+  case Compare::Eq:
+    return lhs == cond.value;
+  case Compare::Ne:
+    return lhs != cond.value;
+  case Compare::Lt:
+    return lhs < cond.value;
+  case Compare::Le:
+    return lhs <= cond.value;
+  case Compare::Gt:
+    return lhs > cond.value;
+  case Compare::Ge:
+    return lhs >= cond.value;
+  }
+  return false;
+}
+
+bool Debugger::writesWatched(uint16_t opcode, uint16_t &addr) const {
+  // Seuls FX33 (BCD) et FX55 (LD [I], Vx) ecrivent en memoire
+  if ((opcode & 0xF000) != 0xF000)
+    return false;
+
+  unsigned count = 0;
+  if ((opcode & 0xFF) == 0x33)
+    count = 3;
+  else if ((opcode & 0xFF) == 0x55)
+    count = ((opcode >> 8) & 0x0F) + 1;
+  else
+    return false;
+
+  // Memes adresses que Chip8::writeMemory() : bouclage apres 0xFFF
+  for (unsigned i = 0; i < count; ++i) {
+    unsigned a = (chip8.getI() + i) & (Chip8::MEMORY_SIZE - 1);
+    if (memoryWatch[a]) {
+      addr = static_cast<uint16_t>(a);
+      return true;
+    }
+  }
+  return false;
+}
+
+Debugger::Stop Debugger::cycle() {
+  uint16_t pc = chip8.getPC();
+  char buf[96];
+
+  if (!skipBreakpoint && breakpoints[pc % Chip8::MEMORY_SIZE]) {
+    std::snprintf(buf, sizeof(buf), "Breakpoint 0x%03X", pc);
+    message = buf;
+    return Stop::Breakpoint;
+  }
+  skipBreakpoint = false;
+
+  uint16_t opcode = (chip8.peek(pc) << 8) | chip8.peek(pc + 1);
+  uint16_t written = 0;
+  bool memoryHit = memoryWatch.any() && writesWatched(opcode, written);
+  uint16_t oldI = chip8.getI();
+
+  chip8.cycle();
+
+  // Toutes les conditions sont reevaluees, meme si un watchpoint arrete
+  // deja : sinon un front montant sur la meme instruction serait perdu
+  // ou signale en double a l'instruction suivante
+  const Condition *risen = nullptr;
+  for (auto &cond : conditions) {
+    bool now = evaluate(cond);
+    // Arret uniquement quand la condition devient vraie
+    if (now && !cond.wasTrue && !risen) {
+      risen = &cond;
+    }
+    cond.wasTrue = now;
+  }
+
+  Stop stop = Stop::None;
+  if (memoryHit) {
+    std::snprintf(buf, sizeof(buf), "Ecriture 0x%03X par %s (0x%03X)", written,
+                  disassemble(opcode).c_str(), pc);
+    message = buf;
+    stop = Stop::MemoryWatch;
+  } else {
+    uint16_t newI = chip8.getI();
+    if (newI != oldI && indexWatch[newI & (Chip8::MEMORY_SIZE - 1)]) {
+      std::snprintf(buf, sizeof(buf), "I = 0x%03X par %s (0x%03X)", newI,
+                    disassemble(opcode).c_str(), pc);
+      message = buf;
+      stop = Stop::IndexWatch;
+    }
+  }
+
+  if (risen) {
+    if (stop == Stop::None) {
+      message = "Condition " + risen->text;
+      stop = Stop::Condition;
+    } else {
+      message += ", condition " + risen->text;
+    }
+  }
+  return stop;
+}
+
+Debugger::Stop Debugger::step() {
+  skipBreakpoint = true;
+  return cycle();
+}
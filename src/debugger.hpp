@@ -0,0 +1,64 @@
+#ifndef DEBUGGER_HPP
+#define DEBUGGER_HPP
+
+#include "chip8.hpp"
+#include <bitset>
+#include <string>
+#include <vector>
+
+// Debugger : pilote un Chip8 instruction par instruction.
+// Les verifications (bitmaps par adresse) sont faites ici, avant/apres
+// Chip8::cycle(), qui reste inchange : sans debugger, aucun surcout.
+class Debugger {
+public:
+  enum class Stop { None, Breakpoint, MemoryWatch, IndexWatch, Condition };
+
+  explicit Debugger(Chip8 &chip8);
+
+  // Breakpoints sur PC
+  void setBreakpoint(uint16_t addr, bool enabled = true);
+  void toggleBreakpoint(uint16_t addr);
+  bool hasBreakpoint(uint16_t addr) const;
+
+  // Watchpoints : ecriture en memoire / I dans [first, last]
+  void watchMemory(uint16_t first, uint16_t last);
+  void watchIndex(uint16_t first, uint16_t last);
+
+  // Condition sur registre, ex: "V3 == 5", "I >= 0x300", "SP > 2"
+  bool addCondition(const std::string &expr);
+
+  // Execute une instruction ; retourne la raison d'un eventuel arret
+  Stop cycle();
+  // Execute une instruction en ignorant le breakpoint courant
+  Stop step();
+  // Reprend apres un arret sur breakpoint
+  void resume() { skipBreakpoint = true; }
+
+  const std::string &stopMessage() const { return message; }
+
+private:
+  enum class Operand { V, I, SP, DT, ST };
+  enum class Compare { Eq, Ne, Lt, Le, Gt, Ge };
+
+  struct Condition {
+    std::string text;
+    Operand operand;
+    int reg;
+    Compare compare;
+    unsigned value;
+    bool wasTrue;
+  };
+
+  Chip8 &chip8;
+  std::bitset<Chip8::MEMORY_SIZE> breakpoints;
+  std::bitset<Chip8::MEMORY_SIZE> memoryWatch;
+  std::bitset<Chip8::MEMORY_SIZE> indexWatch;
+  std::vector<Condition> conditions;
+  bool skipBreakpoint = false;
+  std::string message;
+
+  bool evaluate(const Condition &cond) const;
+  bool writesWatched(uint16_t opcode, uint16_t &addr) const;
+};
+
+#endif // DEBUGGER_HPP
@@ -0,0 +1,105 @@
+#include "disasm.hpp"
+#include <cstdio>
+
+// Instructions FXNN, indexees par NN
+static const struct {
+  unsigned nn;
+  const char *format;
+} F_OPS[] = {
+    {0x07, "LD V%X, DT"},  {0x0A, "LD V%X, K"},   {0x15, "LD DT, V%X"},
+    {0x18, "LD ST, V%X"},  {0x1E, "ADD I, V%X"},  {0x29, "LD F, V%X"},
+    {0x33, "LD B, V%X"},   {0x55, "LD [I], V%X"}, {0x65, "LD V%X, [I]"},
+};
+
+std::string disassemble(uint16_t opcode) {
+  unsigned x = (opcode >> 8) & 0x0F;
+  unsigned y = (opcode >> 4) & 0x0F;
+  unsigned n = opcode & 0x0F;
+  unsigned nn = opcode & 0xFF;
+  unsigned nnn = opcode & 0x0FFF;
+
+  char buf[32];
+
+  switch (opcode & 0xF000) {
+  case 0x0000:
+    if (opcode == 0x00E0)
+      return "CLS";
+    if (opcode == 0x00EE)
+      return "RET";
+    std::snprintf(buf, sizeof(buf), "SYS 0x%03X", nnn);
+    return buf;
+  case 0x1000:
+    std::snprintf(buf, sizeof(buf), "JP 0x%03X", nnn);
+    return buf;
+  case 0x2000:
+    std::snprintf(buf, sizeof(buf), "CALL 0x%03X", nnn);
+    return buf;
+  case 0x3000:
+    std::snprintf(buf, sizeof(buf), "SE V%X, 0x%02X", x, nn);
+    return buf;
+  case 0x4000:
+    std::snprintf(buf, sizeof(buf), "SNE V%X, 0x%02X", x, nn);
+    return buf;
+  case 0x5000:
+    std::snprintf(buf, sizeof(buf), "SE V%X, V%X", x, y);
+    return buf;
+  case 0x6000:
+    std::snprintf(buf, sizeof(buf), "LD V%X, 0x%02X", x, nn);
+    return buf;
+  case 0x7000:
+    std::snprintf(buf, sizeof(buf), "ADD V%X, 0x%02X", x, nn);
+    return buf;
+  case 0x8000: {
+    static const char *const OPS[16] = {"LD",  "OR",   "AND", "XOR",
+                                        "ADD", "SUB",  "SHR", "SUBN",
+                                        nullptr, nullptr, nullptr, nullptr,
+                                        nullptr, nullptr, "SHL", nullptr};
+    if (!OPS[n])
+      break;
+    std::snprintf(buf, sizeof(buf), "%s V%X, V%X", OPS[n], x, y);
+    return buf;
+  }
+  case 0x9000:
+    std::snprintf(buf, sizeof(buf), "SNE V%X, V%X", x, y);
+    return buf;
+  case 0xA000:
+    std::snprintf(buf, sizeof(buf), "LD I, 0x%03X", nnn);
+    return buf;
+  case 0xB000:
+    std::snprintf(buf, sizeof(buf), "JP V0, 0x%03X", nnn);
+    return buf;
+  case 0xC000:
+    std::snprintf(buf, sizeof(buf), "RND V%X, 0x%02X", x, nn);
+    return buf;
+  case 0xD000:
+    std::snprintf(buf, sizeof(buf), "DRW V%X, V%X, %u", x, y, n);
+    return buf;
+  case 0xE000:
+    if (nn == 0x9E) {
+      std::snprintf(buf, sizeof(buf), "SKP V%X", x);
+      return buf;
+    }
+    if (nn == 0xA1) {
+      std::snprintf(buf, sizeof(buf), "SKNP V%X", x);
+      return buf;
+    }
+    break;
+  case 0xF000:
+    for (const auto &op : F_OPS) {
+      if (op.nn == nn) {
+        std::snprintf(buf, sizeof(buf), op.format, x);
+        return buf;
+      }
+    }
+    break;
+  }
+
+  std::snprintf(buf, sizeof(buf), "DW 0x%04X", static_cast<unsigned>(opcode));
+  return buf;
+}
+
+bool isValidOpcode(uint16_t opcode) {
+  // disassemble() retombe sur "SYS"/"DW" pour tout le reste
+  std::string text = disassemble(opcode);
+  return text.compare(0, 3, "DW ") != 0 && text.compare(0, 4, "SYS ") != 0;
+}
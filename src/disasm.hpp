@@ -0,0 +1,13 @@
+#ifndef DISASM_HPP
+#define DISASM_HPP
+
+#include <cstdint>
+#include <string>
+
+// Desassemble un opcode CHIP-8 (syntaxe Cowgod), ex: "LD V3, 0x1F"
+std::string disassemble(uint16_t opcode);
+
+// Vrai si l'opcode fait partie des 35 instructions CHIP-8 (hors SYS)
+bool isValidOpcode(uint16_t opcode);
+
+#endif // DISASM_HPP
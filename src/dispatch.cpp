@@ -0,0 +1,316 @@
+#include "chip8.hpp"
+#include "latency.hpp"
+#include <array>
+#include <utility>
+
+// Table de dispatch generee a la compilation : une entree par opcode
+// (65536) pointant vers un handler specialise, cycleTable() n'a plus
+// qu'un appel indirect a faire.
+//
+// Un handler est instancie par famille d'opcode et non par opcode : sa
+// cle garde les bits qui choisissent l'operation (et x quand il designe
+// un seul registre), les operandes nn, nnn et y sont lus dans l'opcode a
+// l'execution. On obtient ~300 handlers au lieu d'un par opcode, ce qui
+// rend la compilation independante des 65536 valeurs. Les opcodes
+// inconnus (ceux que disassemble() ecrit "SYS"/"DW") vont tous vers
+// unknown().
+
+struct OpcodeTable {
+  using Handler = void (*)(Chip8 &, uint16_t);
+
+  // Meme decodage que isValidOpcode()
+  static constexpr bool known(unsigned op) {
+    unsigned nn = op & 0xFF;
+    switch (op & 0xF000) {
+    case 0x0000:
+      return op == 0x00E0 || op == 0x00EE;
+    case 0x8000: {
+      unsigned n = op & 0x0F;
+      return n <= 0x7 || n == 0xE;
+    }
+    case 0xE000:
+      return nn == 0x9E || nn == 0xA1;
+    case 0xF000:
+      return nn == 0x07 || nn == 0x0A || nn == 0x15 || nn == 0x18 ||
+             nn == 0x1E || nn == 0x29 || nn == 0x33 || nn == 0x55 ||
+             nn == 0x65;
+    default:
+      return true;
+    }
+  }
+
+  // Familles ou x est une constante du handler
+  static constexpr bool keyHasX(unsigned op) {
+    switch (op & 0xF000) {
+    case 0x3000:
+    case 0x4000:
+    case 0x6000:
+    case 0x7000:
+    case 0xC000:
+    case 0xE000:
+    case 0xF000:
+      return true;
+    default:
+      return false;
+    }
+  }
+
+  static void unknown(Chip8 &c, uint16_t) { ++c.unknownOpcodes; }
+
+  // Op : cle du handler (voir handler()), op : opcode execute
+  template <uint16_t Op> static void exec(Chip8 &c, uint16_t op) {
+    const uint8_t x = ((keyHasX(Op) ? Op : op) >> 8) & 0x0F;
+    const uint8_t y = (op >> 4) & 0x0F;
+    constexpr uint8_t n = Op & 0x0F;   // Operation de 8XYN, hauteur de DXYN
+    constexpr uint8_t sub = Op & 0xFF; // Operation de EXNN et FXNN
+    const uint8_t nn = op & 0xFF;
+    const uint16_t nnn = op & 0x0FFF;
+    auto &V = c.V;
+
+    if constexpr (Op == 0x00E0) { // CLS
+      c.display.fill(0);
+      c.drawFlag = true;
+    } else if constexpr (Op == 0x00EE) { // RET
+      --c.sp;
+      c.pc = c.stack[c.sp];
+    } else if constexpr ((Op & 0xF000) == 0x1000) { // JP addr
+      c.pc = nnn;
+    } else if constexpr ((Op & 0xF000) == 0x2000) { // CALL addr
+      c.stack[c.sp] = c.pc;
+      ++c.sp;
+      c.pc = nnn;
+    } else if constexpr ((Op & 0xF000) == 0x3000) { // SE Vx, byte
+      if (V[x] == nn)
+        c.pc += 2;
+    } else if constexpr ((Op & 0xF000) == 0x4000) { // SNE Vx, byte
+      if (V[x] != nn)
+        c.pc += 2;
+    } else if constexpr ((Op & 0xF000) == 0x5000) { // SE Vx, Vy
+      if (V[x] == V[y])
+        c.pc += 2;
+    } else if constexpr ((Op & 0xF000) == 0x6000) { // LD Vx, byte
+      V[x] = nn;
+    } else if constexpr ((Op & 0xF000) == 0x7000) { // ADD Vx, byte
+      V[x] += nn;
+    } else if constexpr ((Op & 0xF000) == 0x8000) {
+      if constexpr (n == 0x0) { // LD Vx, Vy
+        V[x] = V[y];
+      } else if constexpr (n == 0x1) { // OR Vx, Vy
+        V[x] |= V[y];
+        if (c.quirks.vfReset)
+          V[0xF] = 0;
+      } else if constexpr (n == 0x2) { // AND Vx, Vy
+        V[x] &= V[y];
+        if (c.quirks.vfReset)
+          V[0xF] = 0;
+      } else if constexpr (n == 0x3) { // XOR Vx, Vy
+        V[x] ^= V[y];
+        if (c.quirks.vfReset)
+          V[0xF] = 0;
+      } else if constexpr (n == 0x4) { // ADD Vx, Vy
+        uint16_t sum = V[x] + V[y];
+        V[0xF] = (sum > 255) ? 1 : 0;
+        V[x] = sum & 0xFF;
+      } else if constexpr (n == 0x5) { // SUB Vx, Vy
+        V[0xF] = (V[x] > V[y]) ? 1 : 0;
+        V[x] -= V[y];
+      } else if constexpr (n == 0x6) { // SHR Vx
+        if (c.quirks.shiftUsesVy)
+          V[x] = V[y];
+        V[0xF] = V[x] & 0x1;
+        V[x] >>= 1;
+      } else if constexpr (n == 0x7) { // SUBN Vx, Vy
+        V[0xF] = (V[y] > V[x]) ? 1 : 0;
+        V[x] = V[y] - V[x];
+      } else { // SHL Vx
+        if (c.quirks.shiftUsesVy)
+          V[x] = V[y];
+        V[0xF] = (V[x] >> 7) & 0x1;
+        V[x] <<= 1;
+      }
+    } else if constexpr ((Op & 0xF000) == 0x9000) { // SNE Vx, Vy
+      if (V[x] != V[y])
+        c.pc += 2;
+    } else if constexpr ((Op & 0xF000) == 0xA000) { // LD I, addr
+      c.I = nnn;
+    } else if constexpr ((Op & 0xF000) == 0xB000) { // JP V0, addr
+      c.pc = V[c.quirks.jumpUsesVx ? x : 0] + nnn;
+    } else if constexpr ((Op & 0xF000) == 0xC000) { // RND Vx, byte
+      V[x] = c.randByte(c.rng) & nn;
+    } else if constexpr ((Op & 0xF000) == 0xD000) { // DRW Vx, Vy, n
+      uint8_t xPos = V[x] % Chip8::DISPLAY_WIDTH;
+      uint8_t yPos = V[y] % Chip8::DISPLAY_HEIGHT;
+      V[0xF] = 0;
+      uint8_t *pixels = c.display.mutableData();
+
+      for (unsigned int row = 0; row < n; ++row) {
+        uint8_t spriteByte = c.readMemory(c.I + row);
+
+        for (unsigned int col = 0; col < 8; ++col) {
+          uint8_t spritePixel = (spriteByte >> (7 - col)) & 0x1;
+          uint32_t screenX = (xPos + col) % Chip8::DISPLAY_WIDTH;
+          uint32_t screenY = (yPos + row) % Chip8::DISPLAY_HEIGHT;
+          uint32_t idx = screenY * Chip8::DISPLAY_WIDTH + screenX;
+          bool clipped = c.quirks.clipSprites &&
+                         (xPos + col >= Chip8::DISPLAY_WIDTH ||
+                          yPos + row >= Chip8::DISPLAY_HEIGHT);
+
+          if (spritePixel && !clipped) {
+            if (pixels[idx]) {
+              V[0xF] = 1; // Collision
+            }
+            pixels[idx] ^= 1;
+          }
+        }
+      }
+      c.drawFlag = true;
+      if (c.latency)
+        c.latency->onDraw();
+    } else if constexpr ((Op & 0xF000) == 0xE000) {
+      if (c.latency)
+        c.latency->onKeyRead(V[x]);
+      if constexpr (sub == 0x9E) { // SKP Vx
+        if (c.keypad[V[x]])
+          c.pc += 2;
+      } else { // SKNP Vx
+        if (!c.keypad[V[x]])
+          c.pc += 2;
+      }
+    } else if constexpr (sub == 0x07) { // LD Vx, DT
+      V[x] = c.delayTimer;
+    } else if constexpr (sub == 0x0A) { // LD Vx, K
+      if (c.latency)
+        c.latency->onKeyRead(-1);
+      for (int i = 0; i < Chip8::NUM_KEYS; ++i) {
+        if (c.keypad[i]) {
+          V[x] = i;
+          return;
+        }
+      }
+      c.pc -= 2; // Répéter cette instruction
+    } else if constexpr (sub == 0x15) { // LD DT, Vx
+      c.delayTimer = V[x];
+    } else if constexpr (sub == 0x18) { // LD ST, Vx
+      c.soundTimer = V[x];
+    } else if constexpr (sub == 0x1E) { // ADD I, Vx
+      c.I += V[x];
+    } else if constexpr (sub == 0x29) { // LD F, Vx
+      c.I = Chip8::FONTSET_START + (V[x] * 5);
+    } else if constexpr (sub == 0x33) { // LD B, Vx
+      c.writeMemory(c.I, V[x] / 100);
+      c.writeMemory(c.I + 1, (V[x] / 10) % 10);
+      c.writeMemory(c.I + 2, V[x] % 10);
+    } else if constexpr (sub == 0x55) { // LD [I], Vx
+      for (int i = 0; i <= x; ++i) {
+        c.writeMemory(c.I + i, V[i]);
+      }
+      if (c.quirks.memoryIncrementsI)
+        c.I += x + 1;
+    } else { // LD Vx, [I]
+      for (int i = 0; i <= x; ++i) {
+        V[i] = c.readMemory(c.I + i);
+      }
+      if (c.quirks.memoryIncrementsI)
+        c.I += x + 1;
+    }
+  }
+
+  // Handlers d'une famille indexes par x (cle Base | x << 8)
+  template <uint16_t Base, size_t... X>
+  static constexpr std::array<Handler, 16> byX(std::index_sequence<X...>) {
+    return {{&exec<static_cast<uint16_t>(Base | (X << 8))>...}};
+  }
+  template <uint16_t Base> static constexpr std::array<Handler, 16> byX() {
+    return byX<Base>(std::make_index_sequence<16>());
+  }
+
+  // Handlers d'une famille indexes par n (cle Base | n)
+  template <uint16_t Base, size_t... N>
+  static constexpr std::array<Handler, 16> byN(std::index_sequence<N...>) {
+    return {{(known(Base | N) ? &exec<static_cast<uint16_t>(Base | N)>
+                              : &unknown)...}};
+  }
+
+  template <uint16_t Base>
+  static constexpr std::array<Handler, 16> X_HANDLERS = byX<Base>();
+  template <uint16_t Base>
+  static constexpr std::array<Handler, 16> N_HANDLERS =
+      byN<Base>(std::make_index_sequence<16>());
+
+  static constexpr Handler handler(unsigned op) {
+    if (!known(op))
+      return &unknown;
+    unsigned x = (op >> 8) & 0x0F;
+    switch (op & 0xF000) {
+    case 0x0000:
+      return op == 0x00E0 ? &exec<0x00E0> : &exec<0x00EE>;
+    case 0x1000:
+      return &exec<0x1000>;
+    case 0x2000:
+      return &exec<0x2000>;
+    case 0x3000:
+      return X_HANDLERS<0x3000>[x];
+    case 0x4000:
+      return X_HANDLERS<0x4000>[x];
+    case 0x5000:
+      return &exec<0x5000>;
+    case 0x6000:
+      return X_HANDLERS<0x6000>[x];
+    case 0x7000:
+      return X_HANDLERS<0x7000>[x];
+    case 0x8000:
+      return N_HANDLERS<0x8000>[op & 0x0F];
+    case 0x9000:
+      return &exec<0x9000>;
+    case 0xA000:
+      return &exec<0xA000>;
+    case 0xB000:
+      return &exec<0xB000>;
+    case 0xC000:
+      return X_HANDLERS<0xC000>[x];
+    case 0xD000:
+      return N_HANDLERS<0xD000>[op & 0x0F];
+    case 0xE000:
+      return (op & 0xFF) == 0x9E ? X_HANDLERS<0xE09E>[x]
+                                 : X_HANDLERS<0xE0A1>[x];
+    default:
+      switch (op & 0xFF) {
+      case 0x07:
+        return X_HANDLERS<0xF007>[x];
+      case 0x0A:
+        return X_HANDLERS<0xF00A>[x];
+      case 0x15:
+        return X_HANDLERS<0xF015>[x];
+      case 0x18:
+        return X_HANDLERS<0xF018>[x];
+      case 0x1E:
+        return X_HANDLERS<0xF01E>[x];
+      case 0x29:
+        return X_HANDLERS<0xF029>[x];
+      case 0x33:
+        return X_HANDLERS<0xF033>[x];
+      case 0x55:
+        return X_HANDLERS<0xF055>[x];
+      default:
+        return X_HANDLERS<0xF065>[x];
+      }
+    }
+  }
+
+  static constexpr std::array<Handler, 0x10000> makeTable() {
+    std::array<Handler, 0x10000> table{};
+    for (unsigned op = 0; op < table.size(); ++op) {
+      table[op] = handler(op);
+    }
+    return table;
+  }
+};
+
+static constexpr std::array<OpcodeTable::Handler, 0x10000> TABLE =
+    OpcodeTable::makeTable();
+
+void Chip8::cycleTable() {
+  uint16_t opcode = (readMemory(pc) << 8) | readMemory(pc + 1);
+  pc += 2;
+  TABLE[opcode](*this, opcode);
+}
@@ -1,10 +1,11 @@
 #ifndef DISPLAY_HPP
 #define DISPLAY_HPP
 
-#include <SDL2/SDL.h>
 #include <cstdint>
 #include <string>
 
+class LatencyTracker;
+
 // Evenements speciaux retournes par processEvents
 enum class InputEvent {
   None,
@@ -14,34 +15,52 @@ enum class InputEvent {
   ColorNext,
   ColorPrev,
   SpeedUp,
-  SpeedDown
+  SpeedDown,
+  DebugBreak,      // F6 : arret / reprise
+  DebugStep,       // F7 : pas a pas
+  DebugBreakpoint, // F9 : breakpoint sur PC
+  DebugView        // F10 : fenetre du debugger
 };
 
+// Sortie video et entrees clavier : SdlDisplay (fenetre) ou
+// TerminalDisplay (--term)
 class Display {
 public:
-  Display();
-  ~Display();
-
-  bool init(int scale = 10);
-  void render(const uint8_t *framebuffer);
-  void cleanup();
-  InputEvent processEvents(uint8_t *keypad);
-  void setTitle(const std::string &title);
-  void setColors(uint32_t fg, uint32_t bg);
-  SDL_Renderer *getRenderer() { return renderer; }
-
-private:
-  SDL_Window *window = nullptr;
-  SDL_Renderer *renderer = nullptr;
-  SDL_Texture *texture = nullptr;
-  int scale;
-  uint32_t fgColor = 0xFFFFFFFF;
-  uint32_t bgColor = 0x000000FF;
+  virtual ~Display() = default;
+
+  virtual bool init(int scale = 10) = 0;
+  virtual void render(const uint8_t *framebuffer) = 0;
+  virtual InputEvent processEvents(uint8_t *keypad) = 0;
+  virtual void setTitle(const std::string &title) = 0;
+  virtual void setColors(uint32_t fg, uint32_t bg) = 0;
+  void setLatencyTracker(LatencyTracker *tracker) { latency = tracker; }
+
+  // Disposition du clavier : touche (caractere) de chaque touche CHIP-8,
+  // de 0 a F. Faux si keys ne fait pas 16 caracteres.
+  static constexpr const char *DEFAULT_KEYS = "x123qweasdzc4rfv";
+  bool setKeyMap(const std::string &keys) {
+    if (keys.size() != 16)
+      return false;
+    keyMap = keys;
+    return true;
+  }
+
+protected:
+  LatencyTracker *latency = nullptr;
+  std::string keyMap = DEFAULT_KEYS;
+
+  // Touche CHIP-8 d'un caractere (majuscules comprises), -1 si aucune
+  int chip8Key(int hostKey) const {
+    if (hostKey >= 'A' && hostKey <= 'Z')
+      hostKey += 'a' - 'A';
+    if (hostKey <= 0 || hostKey >= 128)
+      return -1;
+    size_t pos = keyMap.find(static_cast<char>(hostKey));
+    return pos != std::string::npos ? static_cast<int>(pos) : -1;
+  }
 
   static constexpr int WIDTH = 64;
   static constexpr int HEIGHT = 32;
-
-  int getChip8Key(SDL_Keycode key);
 };
 
 #endif // DISPLAY_HPP
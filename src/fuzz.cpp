@@ -0,0 +1,157 @@
+// chip8_fuzz : harnais libFuzzer pour le coeur CHIP-8.
+//
+// Entree : [taille ROM, 2 octets big-endian][ROM][script clavier]
+// Script : enregistrements de 3 octets (delai en frames, masque 16 touches)
+//
+// Chaque entree repart d'une machine de reference par copie (pages
+// partagees en copie-sur-ecriture) : pas de remise a zero complete.
+// Avant chaque instruction, les acces hors limites sont detectes et
+// signales par abort() pour que libFuzzer conserve l'entree. Le coeur
+// fait boucler les adresses sur 4 Ko, mais une ROM qui lit ou ecrit
+// au-dela de 0xFFF via I reste signalee : c'est presque toujours un bug.
+// CHIP8_FUZZ_NOABORT=1 : compter les violations sans s'arreter.
+
+#include "chip8.hpp"
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+
+static constexpr int MAX_FRAMES = 120;
+static constexpr int CYCLES_PER_FRAME = 10;
+
+// Decrit l'acces hors limites que ferait la prochaine instruction
+static const char *checkBounds(const Chip8 &c) {
+  const unsigned pc = c.getPC();
+  const uint16_t opcode = (c.peek(pc) << 8) | c.peek(pc + 1);
+  const unsigned x = (opcode >> 8) & 0x0F;
+  const unsigned n = opcode & 0x0F;
+  const unsigned nn = opcode & 0xFF;
+  const unsigned I = c.getI();
+
+  switch (opcode & 0xF000) {
+  case 0x0000:
+    if (opcode == 0x00EE && c.getSP() == 0)
+      return "00EE: pile vide (underflow)";
+    break;
+  case 0x2000:
+    if (c.getSP() >= Chip8::STACK_SIZE)
+      return "2NNN: pile pleine (overflow)";
+    break;
+  case 0xD000:
+    if (n > 0 && I + n > Chip8::MEMORY_SIZE)
+      return "DXYN: memory[I + row] au-dela de 0xFFF";
+    break;
+  case 0xE000:
+    if ((nn == 0x9E || nn == 0xA1) && c.getV(x) >= Chip8::NUM_KEYS)
+      return "EX9E/EXA1: touche VX > 0xF";
+    break;
+  case 0xF000:
+    if (nn == 0x33 && I + 3 > Chip8::MEMORY_SIZE)
+      return "FX33: ecriture au-dela de 0xFFF";
+    if (nn == 0x55 && I + x + 1 > Chip8::MEMORY_SIZE)
+      return "FX55: ecriture au-dela de 0xFFF";
+    if (nn == 0x65 && I + x + 1 > Chip8::MEMORY_SIZE)
+      return "FX65: lecture au-dela de 0xFFF";
+    break;
+  }
+  return nullptr;
+}
+
+static void report(const Chip8 &c, const char *what) {
+  static const bool abortOnViolation =
+      std::getenv("CHIP8_FUZZ_NOABORT") == nullptr;
+  const unsigned pc = c.getPC();
+  std::fprintf(stderr,
+               "chip8_fuzz: %s (pc=0x%03X opcode=0x%02X%02X I=0x%04X sp=%u)\n",
+               what, pc, c.peek(pc), c.peek(pc + 1), c.getI(), c.getSP());
+  if (abortOnViolation)
+    std::abort();
+}
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size) {
+  // Machine de reference (fontset charge, graine fixe), creee une fois
+  static const Chip8 pristine(0);
+
+  if (size < 2)
+    return 0;
+
+  size_t romSize = (data[0] << 8) | data[1];
+  data += 2;
+  size -= 2;
+  if (romSize > size)
+    romSize = size;
+  if (romSize > static_cast<size_t>(Chip8::MEMORY_SIZE - Chip8::START_ADDRESS))
+    romSize = Chip8::MEMORY_SIZE - Chip8::START_ADDRESS;
+
+  Chip8 chip8 = pristine;
+  chip8.loadROM(data, romSize);
+
+  const uint8_t *script = data + romSize;
+  const uint8_t *scriptEnd = data + size;
+  int nextEvent = 0;
+
+  for (int frame = 0; frame < MAX_FRAMES; ++frame) {
+    // Evenements clavier dus a cette frame
+    while (scriptEnd - script >= 3 && nextEvent + script[0] <= frame) {
+      nextEvent += script[0];
+      uint16_t mask = (script[1] << 8) | script[2];
+      for (int k = 0; k < Chip8::NUM_KEYS; ++k) {
+        chip8.setKey(k, (mask >> k) & 1);
+      }
+      script += 3;
+    }
+
+    for (int i = 0; i < CYCLES_PER_FRAME; ++i) {
+      if (const char *what = checkBounds(chip8)) {
+        report(chip8, what);
+        return 0; // Comportement indefini : on n'execute pas
+      }
+      chip8.cycle();
+    }
+    chip8.updateTimers();
+  }
+
+  return 0;
+}
+
+#ifdef CHIP8_FUZZ_STANDALONE
+// Sans libFuzzer (GCC) : rejoue les fichiers donnes en argument
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <vector>
+
+int main(int argc, char *argv[]) {
+  if (argc < 2) {
+    std::cerr << "Usage: chip8_fuzz <entree>... [-runs=N]" << std::endl;
+    return 1;
+  }
+
+  long runs = 1;
+  std::vector<std::vector<uint8_t>> inputs;
+  for (int i = 1; i < argc; ++i) {
+    std::string arg = argv[i];
+    if (arg.rfind("-runs=", 0) == 0) {
+      runs = std::atol(arg.c_str() + 6);
+      continue;
+    }
+    std::ifstream file(arg, std::ios::binary);
+    inputs.emplace_back(std::istreambuf_iterator<char>(file),
+                        std::istreambuf_iterator<char>());
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  for (long r = 0; r < runs; ++r) {
+    for (const auto &input : inputs) {
+      LLVMFuzzerTestOneInput(input.data(), input.size());
+    }
+  }
+  std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+
+  std::cout << runs * inputs.size() << " executions en " << elapsed.count()
+            << " s" << std::endl;
+  return 0;
+}
+#endif
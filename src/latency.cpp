@@ -0,0 +1,141 @@
+#include "latency.hpp"
+#include <cstdio>
+
+int LatencyHistogram::bucketIndex(uint64_t value) {
+  if (value < 2 * SUB_BUCKETS) {
+    return static_cast<int>(value);
+  }
+  int msb = 63 - __builtin_clzll(value);
+  int shift = msb - SUB_BUCKET_BITS;
+  return 2 * SUB_BUCKETS + (shift - 1) * SUB_BUCKETS +
+         static_cast<int>((value >> shift) - SUB_BUCKETS);
+}
+
+uint64_t LatencyHistogram::bucketValue(int index) {
+  if (index < 2 * SUB_BUCKETS) {
+    return static_cast<uint64_t>(index);
+  }
+  int shift = (index - 2 * SUB_BUCKETS) / SUB_BUCKETS + 1;
+  uint64_t sub = (index - 2 * SUB_BUCKETS) % SUB_BUCKETS + SUB_BUCKETS;
+  // Borne haute de l'intervalle
+  return ((sub + 1) << shift) - 1;
+}
+
+void LatencyHistogram::record(uint64_t value) {
+  ++counts[bucketIndex(value)];
+  ++total;
+  if (value > maxValue) {
+    maxValue = value;
+  }
+}
+
+uint64_t LatencyHistogram::percentile(double p) const {
+  if (total == 0) {
+    return 0;
+  }
+
+  uint64_t rank = static_cast<uint64_t>(p / 100.0 * total + 0.5);
+  if (rank < 1)
+    rank = 1;
+
+  uint64_t seen = 0;
+  for (int i = 0; i < NUM_BUCKETS; ++i) {
+    seen += counts[i];
+    if (seen >= rank) {
+      uint64_t value = bucketValue(i);
+      return value < maxValue ? value : maxValue;
+    }
+  }
+  return maxValue;
+}
+
+void LatencyTracker::advance(Pending &p, Stage stage, Clock::time_point now) {
+  if (p.stage != stage) {
+    return;
+  }
+
+  auto micros =
+      std::chrono::duration_cast<std::chrono::microseconds>(now - p.event);
+  histograms[stage].record(static_cast<uint64_t>(micros.count()));
+
+  p.stage = stage + 1;
+  if (p.stage == NUM_STAGES) {
+    --waiting;
+  }
+}
+
+void LatencyTracker::onKeyEvent(int key) {
+  if (key < 0 || key >= 16) {
+    return;
+  }
+  // Un nouvel evenement remplace le precedent sur la meme touche
+  if (pending[key].stage == NUM_STAGES) {
+    ++waiting;
+  }
+  pending[key].event = Clock::now();
+  pending[key].stage = SetKey;
+}
+
+void LatencyTracker::onSetKey(int key) {
+  if (key >= 0 && key < 16) {
+    advance(pending[key], SetKey, Clock::now());
+  }
+}
+
+void LatencyTracker::onKeyRead(int key) {
+  if (waiting == 0) {
+    return;
+  }
+  auto now = Clock::now();
+  if (key >= 0 && key < 16) {
+    advance(pending[key], Read, now);
+  } else if (key < 0) {
+    for (auto &p : pending) {
+      advance(p, Read, now);
+    }
+  }
+}
+
+void LatencyTracker::onDraw() {
+  if (waiting == 0) {
+    return;
+  }
+  auto now = Clock::now();
+  for (auto &p : pending) {
+    advance(p, Draw, now);
+  }
+}
+
+void LatencyTracker::onPresent() {
+  if (waiting == 0) {
+    return;
+  }
+  auto now = Clock::now();
+  for (auto &p : pending) {
+    advance(p, Present, now);
+  }
+}
+
+void LatencyTracker::dump(std::ostream &out) const {
+  static const char *const NAMES[NUM_STAGES] = {"setKey", "lecture", "DXYN",
+                                                "present"};
+  char line[128];
+
+  out << "Latence depuis l'evenement clavier (us)" << std::endl;
+  std::snprintf(line, sizeof(line), "  %-8s %8s %8s %8s %8s %8s %8s", "etape",
+                "n", "p50", "p90", "p99", "p99.9", "max");
+  out << line << std::endl;
+
+  for (int s = 0; s < NUM_STAGES; ++s) {
+    const LatencyHistogram &h = histograms[s];
+    std::snprintf(line, sizeof(line),
+                  "  %-8s %8llu %8llu %8llu %8llu %8llu %8llu", NAMES[s],
+                  static_cast<unsigned long long>(h.count()),
+                  static_cast<unsigned long long>(h.percentile(50.0)),
+                  static_cast<unsigned long long>(h.percentile(90.0)),
+                  static_cast<unsigned long long>(h.percentile(99.0)),
+                  static_cast<unsigned long long>(h.percentile(99.9)),
+                  static_cast<unsigned long long>(h.max()));
+    out << line << std::endl;
+  }
+}
@@ -0,0 +1,60 @@
+#ifndef LATENCY_HPP
+#define LATENCY_HPP
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+
+// Histogramme log-lineaire (facon HdrHistogram) : valeurs exactes jusqu'a
+// 64, puis 32 sous-intervalles par puissance de 2 (~3 % de precision)
+class LatencyHistogram {
+public:
+  void record(uint64_t value);
+  uint64_t percentile(double p) const;
+  uint64_t count() const { return total; }
+  uint64_t max() const { return maxValue; }
+
+private:
+  static constexpr int SUB_BUCKET_BITS = 5;
+  static constexpr int SUB_BUCKETS = 1 << SUB_BUCKET_BITS;
+  static constexpr int NUM_BUCKETS = 2 * SUB_BUCKETS + 58 * SUB_BUCKETS;
+
+  std::array<uint64_t, NUM_BUCKETS> counts{};
+  uint64_t total = 0;
+  uint64_t maxValue = 0;
+
+  static int bucketIndex(uint64_t value);
+  static uint64_t bucketValue(int index);
+};
+
+// Suit chaque evenement clavier jusqu'a l'image qui en montre l'effet :
+// evenement -> setKey -> lecture (SKP/SKNP/FX0A) -> DXYN -> present
+class LatencyTracker {
+public:
+  enum Stage { SetKey, Read, Draw, Present, NUM_STAGES };
+
+  void onKeyEvent(int key);  // Display::processEvents
+  void onSetKey(int key);    // Chip8::setKey (changement d'etat)
+  void onKeyRead(int key);   // SKP/SKNP, ou -1 pour FX0A (toutes)
+  void onDraw();             // DXYN
+  void onPresent();          // Apres SDL_RenderPresent
+
+  void dump(std::ostream &out) const;
+
+private:
+  using Clock = std::chrono::steady_clock;
+
+  struct Pending {
+    Clock::time_point event;
+    int stage = NUM_STAGES; // Prochaine etape attendue
+  };
+
+  std::array<Pending, 16> pending{};
+  std::array<LatencyHistogram, NUM_STAGES> histograms{};
+  int waiting = 0; // Evenements pas encore presentes
+
+  void advance(Pending &p, Stage stage, Clock::time_point now);
+};
+
+#endif // LATENCY_HPP
@@ -1,10 +1,26 @@
 #include "chip8.hpp"
-#include "display.hpp"
+#ifdef CHIP8_AOT
+#include "chip8_native.hpp"
+#endif
+#include "debug_view.hpp"
+#include "debugger.hpp"
+#include "latency.hpp"
 #include "menu.hpp"
+#include "profile.hpp"
+#include "sdl_display.hpp"
+#include "shm_frame.hpp"
+#include "terminal_display.hpp"
+#include "timing.hpp"
+#include "trace.hpp"
+#include "wall.hpp"
+#include <algorithm>
 #include <chrono>
+#include <cstdlib>
 #include <filesystem>
 #include <iostream>
+#include <memory>
 #include <thread>
+#include <vector>
 
 namespace fs = std::filesystem;
 
@@ -16,26 +32,161 @@ const uint32_t COLOR_SCHEMES[][2] = {
     {0x00FFFFFF, 0x000066FF}, // Cyan sur bleu
     {0xFF6600FF, 0x000000FF}, // Orange
 };
-const int NUM_SCHEMES = 5;
+const int NUM_SCHEMES = RomProfile::NUM_PALETTES;
+static_assert(sizeof(COLOR_SCHEMES) / sizeof(COLOR_SCHEMES[0]) == NUM_SCHEMES,
+              "une palette par index de profil");
 
 bool runEmulator(const std::string &romPath, Display &display, Chip8 &chip8);
 
+// Plage d'adresses "0x300" ou "0x300-0x30F"
+static bool parseRange(const std::string &text, uint16_t &first,
+                       uint16_t &last) {
+  char *end = nullptr;
+  first = static_cast<uint16_t>(std::strtoul(text.c_str(), &end, 0));
+  last = first;
+  if (*end == '-') {
+    last = static_cast<uint16_t>(std::strtoul(end + 1, &end, 0));
+  }
+  return *end == '\0' && first <= last;
+}
+
 int main(int argc, char *argv[]) {
-  Display display;
+  SdlDisplay window;
+  TerminalDisplay terminal;
+  bool useTerminal = false;
   Chip8 chip8;
+  Debugger debugger(chip8);
+  DebugView debugView;
+  bool debugMode = false;
+  bool measureLatency = false;
+  bool vipTiming = false;
+  LatencyTracker latency;
+  std::string tracePath;
+  std::string shmName;
+  std::string profilePath = "chip8_profiles.ini";
+  int runAhead = 0; // Frames speculatives (--run-ahead N)
+  int wallColumns = 0, wallRows = 0; // Mur d'emulateurs (--wall CxR)
+
+  std::string romPath;
+  std::vector<std::string> romPaths; // Toutes les ROMs (mode mur)
+
+  // Arguments: [options] [rom]
+  for (int i = 1; i < argc; ++i) {
+    std::string arg = argv[i];
+    uint16_t first, last;
+
+    if (arg == "--debug") {
+      debugMode = true;
+    } else if (arg == "--latency") {
+      measureLatency = true;
+    } else if (arg == "--vip-timing") {
+      vipTiming = true;
+    } else if (arg == "--term") {
+      useTerminal = true;
+    } else if (arg == "--trace" && i + 1 < argc) {
+      tracePath = argv[++i];
+    } else if (arg == "--shm" && i + 1 < argc) {
+      shmName = argv[++i];
+    } else if (arg == "--profiles" && i + 1 < argc) {
+      profilePath = argv[++i];
+    } else if (arg == "--run-ahead" && i + 1 < argc) {
+      runAhead = std::atoi(argv[++i]);
+      if (runAhead < 0 || runAhead > 8) {
+        std::cerr << "Run-ahead invalide (0 a 8): " << argv[i] << std::endl;
+        return 1;
+      }
+    } else if (arg == "--wall" && i + 1 < argc) {
+      char *end;
+      wallColumns = static_cast<int>(std::strtol(argv[++i], &end, 10));
+      wallRows = *end == 'x' ? static_cast<int>(std::strtol(end + 1, &end, 10))
+                             : 0;
+      if (*end != '\0' || wallColumns < 1 || wallColumns > 16 ||
+          wallRows < 1 || wallRows > 16) {
+        std::cerr << "Grille invalide (CxR, 1 a 16): " << argv[i] << std::endl;
+        return 1;
+      }
+    } else if (arg == "--break" && i + 1 < argc) {
+      if (!parseRange(argv[++i], first, last) ||
+          last >= Chip8::MEMORY_SIZE) {
+        std::cerr << "Adresse invalide: " << argv[i] << std::endl;
+        return 1;
+      }
+      // Une plage A-B arrete sur chaque adresse de la plage
+      for (unsigned addr = first; addr <= last; ++addr) {
+        debugger.setBreakpoint(static_cast<uint16_t>(addr));
+      }
+      debugMode = true;
+    } else if ((arg == "--watch" || arg == "--watch-i") && i + 1 < argc) {
+      if (!parseRange(argv[++i], first, last)) {
+        std::cerr << "Plage invalide: " << argv[i] << std::endl;
+        return 1;
+      }
+      if (arg == "--watch")
+        debugger.watchMemory(first, last);
+      else
+        debugger.watchIndex(first, last);
+      debugMode = true;
+    } else if (arg == "--cond" && i + 1 < argc) {
+      if (!debugger.addCondition(argv[++i])) {
+        std::cerr << "Condition invalide: " << argv[i] << std::endl;
+        return 1;
+      }
+      debugMode = true;
+    } else if (arg.rfind("--", 0) == 0) {
+      std::cerr << "Option inconnue: " << arg << std::endl;
+      return 1;
+    } else {
+      romPath = arg;
+      romPaths.push_back(arg);
+    }
+  }
 
+  if (wallColumns > 0) {
+    if (useTerminal) {
+      std::cerr << "Erreur: --wall demande une fenetre SDL" << std::endl;
+      return 1;
+    }
+    // Sans ROM en argument : toutes celles du dossier roms
+    if (romPaths.empty()) {
+      romPaths = findRoms(fs::exists("roms") ? "roms" : "../roms");
+    }
+
+    Wall wall(wallColumns, wallRows);
+    // Le mur tient dans 1280x720, quel que soit le rapport CxR
+    int scale = std::max(
+        1, std::min(1280 / (wallColumns * Chip8::DISPLAY_WIDTH),
+                    720 / (wallRows * Chip8::DISPLAY_HEIGHT)));
+    if (!wall.load(romPaths) ||
+        !window.initGrid(wallColumns, wallRows, scale)) {
+      return 1;
+    }
+    window.setTitle("CHIP-8 - mur " + std::to_string(wallColumns) + "x" +
+                    std::to_string(wallRows));
+    wall.run(window);
+    return 0;
+  }
+
+  Display &display = useTerminal ? static_cast<Display &>(terminal) : window;
   if (!display.init(10)) {
     std::cerr << "Erreur d'initialisation de l'affichage" << std::endl;
     return 1;
   }
 
-  std::string romPath;
+#ifdef CHIP8_AOT
+  // Build kiosque : ROM recompilee embarquee, utilisee sans argument
+  Chip8Native native(chip8);
+  bool embedded = romPath.empty();
+#else
+  bool embedded = false;
+#endif
+
+  // Si pas de ROM en argument, afficher le menu
+  if (romPath.empty() && !embedded) {
+    if (useTerminal) {
+      std::cerr << "Erreur: --term demande une ROM en argument" << std::endl;
+      return 1;
+    }
 
-  // Si ROM en argument, la charger directement
-  if (argc >= 2) {
-    romPath = argv[1];
-  } else {
-    // Sinon, afficher le menu
     Menu menu;
 
     // Chercher le dossier roms
@@ -46,8 +197,8 @@ int main(int argc, char *argv[]) {
 
     menu.scanRoms(romsDir);
 
-    menu.init(display.getRenderer());
-    int selection = menu.run(display.getRenderer());
+    menu.init(window.getRenderer());
+    int selection = menu.run(window.getRenderer());
 
     if (selection < 0) {
       return 0; // Utilisateur a quitte
@@ -56,29 +207,178 @@ int main(int argc, char *argv[]) {
     romPath = menu.getSelectedRom();
   }
 
-  if (!chip8.loadROM(romPath)) {
+  // Charge (ou recharge) la ROM courante
+  auto loadGame = [&]() {
+#ifdef CHIP8_AOT
+    bool ok = embedded
+                  ? chip8.loadROM(Chip8Native::ROM, Chip8Native::ROM_SIZE)
+                  : chip8.loadROM(romPath);
+    native.reset();
+    return ok;
+#else
+    return chip8.loadROM(romPath);
+#endif
+  };
+
+  if (!loadGame()) {
     std::cerr << "Erreur de chargement de la ROM: " << romPath << std::endl;
     return 1;
   }
 
   std::string romName = fs::path(romPath).stem().string();
+#ifdef CHIP8_AOT
+  if (embedded) {
+    romName = Chip8Native::ROM_NAME;
+  }
+#endif
   display.setTitle("CHIP-8 - " + romName);
 
-  // Timing
+  // Timing : une iteration par frame de 1/60 s
+  const auto frameDuration = std::chrono::microseconds(1000000 / 60);
   int instructionsPerSecond = 500;
-  int cycleCount = 0;
+  int instructionCredit = 0; // Reste de instructionsPerSecond / 60
+  int cycleCredit = 0;       // Budget VIP en microsecondes (--vip-timing)
   bool running = true;
   bool paused = false;
+  bool halted = false; // Arret du debugger
+  bool debugDirty = true;
+  std::string debugStatus;
   int colorScheme = 0;
 
+  // Profil de la ROM (vitesse, quirks, palette, clavier) par empreinte
+  ProfileDb profiles;
+  profiles.load(profilePath);
+  const uint64_t romHash = hashLoadedRom(chip8);
+  RomProfile profile;
+  profile.name = romName;
+  if (const RomProfile *saved = profiles.find(romHash)) {
+    profile = *saved;
+    std::cout << "Profil: " << profile.instructionsPerSecond << " Hz"
+              << (profile.variant.empty() ? "" : ", " + profile.variant)
+              << std::endl;
+  }
+  instructionsPerSecond =
+      std::clamp(profile.instructionsPerSecond, RomProfile::MIN_IPS,
+                 RomProfile::MAX_IPS);
+  if (profile.palette >= 0 && profile.palette < NUM_SCHEMES) {
+    colorScheme = profile.palette;
+  }
+  display.setColors(COLOR_SCHEMES[colorScheme][0],
+                    COLOR_SCHEMES[colorScheme][1]);
+  chip8.setQuirks(profile.quirks);
+  if (!profile.keys.empty() && !display.setKeyMap(profile.keys)) {
+    std::cerr << "Profil: disposition de clavier invalide (16 touches)"
+              << std::endl;
+  }
+
+  // La fenetre du debugger demande SDL : absente en mode terminal
+  if (debugMode && !useTerminal) {
+    debugView.init();
+    debugView.setVisible(true);
+  }
+
+  if (measureLatency) {
+    chip8.setLatencyTracker(&latency);
+    display.setLatencyTracker(&latency);
+  }
+
+  std::unique_ptr<TraceWriter> tracer;
+  if (!tracePath.empty()) {
+    tracer = std::make_unique<TraceWriter>(tracePath);
+    if (!tracer->isOpen()) {
+      std::cerr << "Erreur: Impossible d'ecrire " << tracePath << std::endl;
+      return 1;
+    }
+  }
+
+  // Frames publiees pour les outils externes (--shm)
+  std::unique_ptr<ShmPublisher> shm;
+  if (!shmName.empty()) {
+    shm = std::make_unique<ShmPublisher>(shmName);
+    if (!shm->isOpen()) {
+      return 1;
+    }
+  }
+
+  // Pas a pas du debugger, trace comprise (rien n'est execute sur un
+  // breakpoint)
+  auto debugCycle = [&](bool stepping) {
+    if (tracer)
+      tracer->begin(chip8);
+    Debugger::Stop stop = stepping ? debugger.step() : debugger.cycle();
+    if (tracer && stop != Debugger::Stop::Breakpoint)
+      tracer->end(chip8);
+    return stop;
+  };
+
+  // Execute une instruction ; faux si le debugger s'arrete
+  auto step = [&]() {
+    if (debugMode) {
+      if (debugCycle(false) != Debugger::Stop::None) {
+        halted = true;
+        debugStatus = debugger.stopMessage();
+        std::cout << "[debug] " << debugStatus << std::endl;
+        debugDirty = true;
+        return false;
+      }
+      return true;
+    }
+    if (tracer)
+      tracer->begin(chip8);
+#ifdef CHIP8_AOT
+    native.run(1);
+#else
+    chip8.cycle();
+#endif
+    if (tracer)
+      tracer->end(chip8);
+    return true;
+  };
+
+  // Execute count instructions (par lot hors debugger et hors trace)
+  auto runInstructions = [&](int count) {
+    if (debugMode || tracer) {
+      for (int i = 0; i < count; ++i) {
+        if (!step()) {
+          return;
+        }
+      }
+      return;
+    }
+#ifdef CHIP8_AOT
+    native.run(count);
+#else
+    for (int i = 0; i < count; ++i) {
+      chip8.cycle();
+    }
+#endif
+  };
+
+  // Avance machine d'une frame, au budget VIP ou a instructionsPerSecond.
+  // stepOne execute une instruction, runBatch un lot
+  auto advanceFrame = [&](Chip8 &machine, int &credit, int &cycles,
+                          auto &&stepOne, auto &&runBatch) {
+    if (vipTiming) {
+      vip::runFrame(machine, cycles, stepOne);
+    } else {
+      credit += instructionsPerSecond;
+      runBatch(credit / 60);
+      credit %= 60;
+    }
+  };
+
   uint8_t keypad[16] = {0};
+  // Touches tenues par les outils --shm : a part, l'affichage relache
+  // lui-meme les siennes (mode terminal)
+  uint8_t shmKeys[16] = {0};
+  bool showingSpeculative = false; // Image de run-ahead a l'ecran
+  auto nextFrame = std::chrono::steady_clock::now();
 
   while (running) {
-    auto cycleDelay =
-        std::chrono::microseconds(1000000 / instructionsPerSecond);
-    auto start = std::chrono::high_resolution_clock::now();
-
     InputEvent event = display.processEvents(keypad);
+    if (shm) {
+      shm->pollInput(shmKeys);
+    }
 
     switch (event) {
     case InputEvent::Quit:
@@ -94,7 +394,7 @@ int main(int argc, char *argv[]) {
       break;
     case InputEvent::Reset:
       chip8.initialize();
-      chip8.loadROM(romPath);
+      loadGame();
       std::fill(keypad, keypad + 16, 0);
       break;
     case InputEvent::ColorNext:
@@ -110,42 +410,154 @@ int main(int argc, char *argv[]) {
       chip8.drawFlag = true;
       break;
     case InputEvent::SpeedUp:
-      instructionsPerSecond = std::min(2000, instructionsPerSecond + 100);
+      instructionsPerSecond =
+          std::min(RomProfile::MAX_IPS, instructionsPerSecond + 100);
       std::cout << "Vitesse: " << instructionsPerSecond << " Hz" << std::endl;
       break;
     case InputEvent::SpeedDown:
-      instructionsPerSecond = std::max(100, instructionsPerSecond - 100);
+      instructionsPerSecond =
+          std::max(RomProfile::MIN_IPS, instructionsPerSecond - 100);
       std::cout << "Vitesse: " << instructionsPerSecond << " Hz" << std::endl;
       break;
+    case InputEvent::DebugBreak:
+      debugMode = true;
+      if (halted) {
+        debugger.resume();
+        debugStatus.clear();
+      } else {
+        debugStatus = "Pause debugger";
+      }
+      halted = !halted;
+      debugDirty = true;
+      break;
+    case InputEvent::DebugStep:
+      debugMode = true;
+      if (halted) {
+        for (int i = 0; i < 16; ++i) {
+          chip8.setKey(i, keypad[i] || shmKeys[i]);
+        }
+        if (debugCycle(true) != Debugger::Stop::None) {
+          debugStatus = debugger.stopMessage();
+        }
+      } else {
+        halted = true;
+        debugStatus = "Pause debugger";
+      }
+      debugDirty = true;
+      break;
+    case InputEvent::DebugBreakpoint:
+      debugMode = true;
+      debugger.toggleBreakpoint(chip8.getPC());
+      debugDirty = true;
+      break;
+    case InputEvent::DebugView:
+      debugMode = true;
+      if (!useTerminal) {
+        debugView.init();
+        debugView.setVisible(!debugView.isVisible());
+      }
+      debugDirty = true;
+      break;
     default:
       break;
     }
 
-    if (!paused) {
+    if (!paused && !halted) {
       for (int i = 0; i < 16; ++i) {
-        chip8.setKey(i, keypad[i] != 0);
+        chip8.setKey(i, keypad[i] || shmKeys[i]);
       }
 
-      chip8.cycle();
+      advanceFrame(chip8, instructionCredit, cycleCredit, step,
+                   runInstructions);
 
-      if (++cycleCount >= instructionsPerSecond / 60) {
+      if (!halted) {
         chip8.updateTimers();
-        cycleCount = 0;
       }
+      if (shm) {
+        shm->publish(chip8);
+      }
+      debugDirty = true;
     }
 
-    if (chip8.drawFlag) {
+    if (debugDirty && debugView.isVisible()) {
+      debugView.render(chip8, debugger, debugStatus);
+      debugDirty = false;
+    }
+
+    if (runAhead > 0 && !paused && !halted && !debugMode) {
+      // Run-ahead : les frames suivantes sont calculees sur une copie avec
+      // le clavier courant et c'est leur image qui est affichee. L'etat
+      // reel n'avance que d'une frame ; la copie est jetee.
+      Chip8 ahead = chip8.forkSpeculative();
+#ifdef CHIP8_AOT
+      Chip8Native aheadNative(ahead);
+#endif
+      auto aheadRun = [&](int count) {
+#ifdef CHIP8_AOT
+        aheadNative.run(count);
+#else
+        for (int i = 0; i < count; ++i) {
+          ahead.cycle();
+        }
+#endif
+      };
+      auto aheadStep = [&]() {
+        aheadRun(1);
+        return true;
+      };
+      int aheadCredit = instructionCredit;
+      int aheadCycleCredit = cycleCredit;
+
+      for (int f = 0; f < runAhead; ++f) {
+        advanceFrame(ahead, aheadCredit, aheadCycleCredit, aheadStep,
+                     aheadRun);
+        ahead.updateTimers();
+      }
+
+      // Presentee a chaque frame : une prediction affichee puis dementie
+      // (clavier change) doit etre effacee meme si rien ne redessine
+      display.render(ahead.display.data());
+      chip8.drawFlag = false;
+      showingSpeculative = true;
+    } else if (chip8.drawFlag || showingSpeculative) {
+      // En pause ou au debugger, l'etat reel remplace l'image speculative
       display.render(chip8.display.data());
       chip8.drawFlag = false;
+      showingSpeculative = false;
     }
 
-    auto end = std::chrono::high_resolution_clock::now();
-    auto elapsed =
-        std::chrono::duration_cast<std::chrono::microseconds>(end - start);
-    if (elapsed < cycleDelay) {
-      std::this_thread::sleep_for(cycleDelay - elapsed);
+    // Attente de la frame suivante (sans derive)
+    nextFrame += frameDuration;
+    auto now = std::chrono::steady_clock::now();
+    if (nextFrame > now) {
+      std::this_thread::sleep_until(nextFrame);
+    } else {
+      nextFrame = now; // En retard : on ne rattrape pas
     }
   }
 
+  if (measureLatency) {
+    latency.dump(std::cout);
+  }
+
+  // Reglages faits a la main (+/-, F1/F2) retenus pour la prochaine fois
+  if (instructionsPerSecond != profile.instructionsPerSecond ||
+      colorScheme != profile.palette) {
+    profile.instructionsPerSecond = instructionsPerSecond;
+    profile.palette = colorScheme;
+    profiles.set(romHash, profile);
+    profiles.save(profilePath);
+  }
+
+  if (chip8.getUnknownOpcodes() > 0) {
+    std::cerr << "Opcodes inconnus executes: " << chip8.getUnknownOpcodes()
+              << std::endl;
+  }
+
+  if (tracer && tracer->dropped() > 0) {
+    std::cerr << "Trace: " << tracer->dropped()
+              << " instructions perdues (file pleine)" << std::endl;
+  }
+
   return 0;
 }
@@ -1,14 +1,19 @@
 #ifndef MENU_HPP
 #define MENU_HPP
 
+#include "preview.hpp"
 #include <SDL2/SDL.h>
 #include <filesystem>
 #include <string>
 #include <vector>
 
+// ROMs (.ch8, .c8, .rom) d'un dossier, triees par nom
+std::vector<std::string> findRoms(const std::string &directory);
+
 class Menu {
 public:
   Menu();
+  ~Menu();
 
   bool init(SDL_Renderer *renderer);
   void scanRoms(const std::string &directory);
@@ -19,9 +24,17 @@ public:
 private:
   std::vector<std::string> romFiles;
   int selectedIndex = 0;
+  int requestedIndex = -1;
   SDL_Texture *fontTexture = nullptr;
+  SDL_Texture *previewTexture = nullptr;
+  PreviewService previews;
+
+  static constexpr int VISIBLE_ITEMS = 10;
+  static constexpr int PREFETCH = 2; // Voisins precalcules de chaque cote
 
+  void updatePreviews();
   void render(SDL_Renderer *renderer);
+  void drawPreview(SDL_Renderer *renderer);
   void drawText(SDL_Renderer *renderer, const std::string &text, int x, int y,
                 bool selected);
 };
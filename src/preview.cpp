@@ -0,0 +1,118 @@
+#include "preview.hpp"
+#include "rom_hash.hpp"
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+
+static size_t workerCount() {
+  unsigned cores = std::thread::hardware_concurrency();
+  // Garder un coeur pour le thread d'interface
+  return std::clamp<size_t>(cores > 1 ? cores - 1 : 1, 1, 4);
+}
+
+PreviewService::PreviewService() : pool(workerCount()) {}
+
+PreviewService::~PreviewService() {
+  std::lock_guard<std::mutex> lock(mutex);
+  for (auto &entry : jobs) {
+    entry.second->cancelled = true;
+  }
+}
+
+void PreviewService::request(const std::string &path) {
+  std::shared_ptr<Job> job;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto known = hashes.find(path);
+    if (known != hashes.end() && previews.count(known->second)) {
+      return;
+    }
+    if (jobs.count(path)) {
+      return;
+    }
+    job = std::make_shared<Job>();
+    jobs[path] = job;
+  }
+
+  pool.submit([this, path, job] { render(path, job); });
+}
+
+void PreviewService::retain(const std::vector<std::string> &keep) {
+  std::lock_guard<std::mutex> lock(mutex);
+  for (auto it = jobs.begin(); it != jobs.end();) {
+    if (std::find(keep.begin(), keep.end(), it->first) == keep.end()) {
+      it->second->cancelled = true;
+      it = jobs.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+bool PreviewService::get(const std::string &path, Frame &out) {
+  std::lock_guard<std::mutex> lock(mutex);
+  auto known = hashes.find(path);
+  if (known == hashes.end()) {
+    return false;
+  }
+  auto preview = previews.find(known->second);
+  if (preview == previews.end()) {
+    return false;
+  }
+  out = *preview->second;
+  return true;
+}
+
+void PreviewService::render(const std::string &path,
+                            const std::shared_ptr<Job> &job) {
+  // Retire la demande (si c'est toujours la notre) en fin de traitement
+  auto finish = [&](uint64_t hash, std::shared_ptr<const Frame> frame) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = jobs.find(path);
+    if (it != jobs.end() && it->second == job) {
+      jobs.erase(it);
+    }
+    hashes[path] = hash;
+    if (frame) {
+      previews.emplace(hash, std::move(frame));
+    }
+  };
+
+  if (job->cancelled) {
+    return;
+  }
+
+  std::ifstream file(path, std::ios::binary);
+  std::vector<uint8_t> rom((std::istreambuf_iterator<char>(file)),
+                           std::istreambuf_iterator<char>());
+  uint64_t hash = hashRom(rom.data(), rom.size());
+
+  bool cached;
+  {
+    // Meme contenu deja calcule sous un autre nom
+    std::lock_guard<std::mutex> lock(mutex);
+    cached = previews.count(hash) != 0;
+  }
+  if (cached) {
+    finish(hash, nullptr);
+    return;
+  }
+
+  Chip8 chip8(0);
+  if (rom.empty() || !chip8.loadROM(rom.data(), rom.size())) {
+    finish(hash, nullptr);
+    return;
+  }
+
+  for (int frame = 0; frame < PREVIEW_FRAMES; ++frame) {
+    if (frame % 10 == 0 && job->cancelled) {
+      return;
+    }
+    chip8.runFrame(CYCLES_PER_FRAME);
+  }
+
+  auto image = std::make_shared<Frame>();
+  std::copy(chip8.display.data(), chip8.display.data() + image->size(),
+            image->begin());
+  finish(hash, std::move(image));
+}
@@ -0,0 +1,50 @@
+#ifndef PREVIEW_HPP
+#define PREVIEW_HPP
+
+#include "chip8.hpp"
+#include "thread_pool.hpp"
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Vignettes de ROMs calculees en arriere-plan : chaque ROM est lue puis
+// executee sans affichage pendant quelques centaines de frames sur un pool
+// de workers. Les images sont mises en cache par empreinte de ROM.
+// Aucune methode n'attend l'emulation ni les acces disque.
+class PreviewService {
+public:
+  using Frame =
+      std::array<uint8_t, Chip8::DISPLAY_WIDTH * Chip8::DISPLAY_HEIGHT>;
+
+  static constexpr int PREVIEW_FRAMES = 300;
+  static constexpr int CYCLES_PER_FRAME = 10;
+
+  PreviewService();
+  ~PreviewService();
+
+  // Demande la vignette d'une ROM (sans effet si deja prete ou en cours)
+  void request(const std::string &path);
+  // Annule les demandes en cours qui ne sont pas dans keep
+  void retain(const std::vector<std::string> &keep);
+  // Copie la vignette si elle est prete
+  bool get(const std::string &path, Frame &out);
+
+private:
+  struct Job {
+    std::atomic<bool> cancelled{false};
+  };
+
+  std::mutex mutex;
+  std::unordered_map<std::string, std::shared_ptr<Job>> jobs; // En cours
+  std::unordered_map<std::string, uint64_t> hashes;           // Chemin -> hash
+  std::unordered_map<uint64_t, std::shared_ptr<const Frame>> previews;
+  ThreadPool pool; // Dernier membre : detruit (joint) en premier
+
+  void render(const std::string &path, const std::shared_ptr<Job> &job);
+};
+
+#endif // PREVIEW_HPP
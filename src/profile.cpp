@@ -0,0 +1,225 @@
+#include "profile.hpp"
+#include "rom_hash.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+// Noms des quirks dans le fichier
+static const struct {
+  const char *name;
+  bool Chip8::Quirks::*flag;
+} QUIRK_NAMES[] = {
+    {"vf-reset", &Chip8::Quirks::vfReset},
+    {"shift-vy", &Chip8::Quirks::shiftUsesVy},
+    {"memory-i", &Chip8::Quirks::memoryIncrementsI},
+    {"jump-vx", &Chip8::Quirks::jumpUsesVx},
+    {"clip", &Chip8::Quirks::clipSprites},
+};
+
+static std::string trim(const std::string &text) {
+  size_t first = text.find_first_not_of(" \t\r");
+  if (first == std::string::npos)
+    return "";
+  size_t last = text.find_last_not_of(" \t\r");
+  return text.substr(first, last - first + 1);
+}
+
+bool quirksForVariant(const std::string &variant, Chip8::Quirks &quirks) {
+  quirks = Chip8::Quirks{};
+  if (variant.empty()) {
+    return true;
+  }
+  if (variant == "chip8") { // COSMAC VIP
+    quirks.vfReset = true;
+    quirks.shiftUsesVy = true;
+    quirks.memoryIncrementsI = true;
+    quirks.clipSprites = true;
+    return true;
+  }
+  if (variant == "schip") {
+    quirks.jumpUsesVx = true;
+    quirks.clipSprites = true;
+    return true;
+  }
+  return false;
+}
+
+static bool parseQuirks(const std::string &text, Chip8::Quirks &quirks) {
+  quirks = Chip8::Quirks{};
+  std::string list = text;
+  for (char &ch : list) {
+    if (ch == ',')
+      ch = ' ';
+  }
+
+  std::istringstream words(list);
+  std::string word;
+  while (words >> word) {
+    bool found = false;
+    for (const auto &quirk : QUIRK_NAMES) {
+      if (word == quirk.name) {
+        quirks.*quirk.flag = true;
+        found = true;
+      }
+    }
+    if (!found)
+      return false;
+  }
+  return true;
+}
+
+// Entier decimal sans caractere parasite
+static bool parseInt(const std::string &text, long &value) {
+  char *end = nullptr;
+  value = std::strtol(text.c_str(), &end, 10);
+  return !text.empty() && *end == '\0';
+}
+
+bool ProfileDb::load(const std::string &path) {
+  std::ifstream file(path);
+  if (!file.is_open()) {
+    return false;
+  }
+
+  RomProfile *current = nullptr;
+  std::string quirksText;
+  bool hasQuirks = false;
+  int lineNumber = 0;
+
+  // Les quirks dependent de la variante : resolus en fin de section
+  auto finishSection = [&]() {
+    if (current) {
+      if (!quirksForVariant(current->variant, current->quirks)) {
+        std::cerr << path << ": variante inconnue " << current->variant
+                  << std::endl;
+      }
+      if (hasQuirks && !parseQuirks(quirksText, current->quirks)) {
+        std::cerr << path << ": quirks invalides " << quirksText << std::endl;
+      }
+    }
+    hasQuirks = false;
+  };
+
+  std::string line;
+  while (std::getline(file, line)) {
+    ++lineNumber;
+    line = trim(line);
+    if (line.empty() || line[0] == '#' || line[0] == ';') {
+      continue;
+    }
+
+    if (line.front() == '[' && line.back() == ']') {
+      finishSection();
+      std::string hex = line.substr(1, line.size() - 2);
+      char *end = nullptr;
+      uint64_t hash = std::strtoull(hex.c_str(), &end, 16);
+      if (hex.empty() || *end != '\0') {
+        std::cerr << path << ":" << lineNumber << ": empreinte invalide"
+                  << std::endl;
+        current = nullptr;
+        continue;
+      }
+      current = &profiles[hash];
+      *current = RomProfile{};
+      continue;
+    }
+
+    size_t equals = line.find('=');
+    if (!current || equals == std::string::npos) {
+      std::cerr << path << ":" << lineNumber << ": ligne ignoree" << std::endl;
+      continue;
+    }
+
+    std::string key = trim(line.substr(0, equals));
+    std::string value = trim(line.substr(equals + 1));
+    if (key == "name") {
+      current->name = value;
+    } else if (key == "ips") {
+      long ips = 0;
+      if (!parseInt(value, ips)) {
+        std::cerr << path << ":" << lineNumber << ": ips invalide " << value
+                  << std::endl;
+      } else if (ips < RomProfile::MIN_IPS || ips > RomProfile::MAX_IPS) {
+        std::cerr << path << ":" << lineNumber << ": ips hors de la plage "
+                  << RomProfile::MIN_IPS << "-" << RomProfile::MAX_IPS
+                  << std::endl;
+        current->instructionsPerSecond = static_cast<int>(std::clamp<long>(
+            ips, RomProfile::MIN_IPS, RomProfile::MAX_IPS));
+      } else {
+        current->instructionsPerSecond = static_cast<int>(ips);
+      }
+    } else if (key == "variant") {
+      current->variant = value;
+    } else if (key == "quirks") {
+      quirksText = value;
+      hasQuirks = true;
+    } else if (key == "palette") {
+      long palette = 0;
+      if (!parseInt(value, palette) || palette < 0 ||
+          palette >= RomProfile::NUM_PALETTES) {
+        std::cerr << path << ":" << lineNumber << ": palette invalide "
+                  << value << " (0-" << RomProfile::NUM_PALETTES - 1 << ")"
+                  << std::endl;
+      } else {
+        current->palette = static_cast<int>(palette);
+      }
+    } else if (key == "keys") {
+      current->keys = value;
+    } else {
+      std::cerr << path << ":" << lineNumber << ": cle inconnue " << key
+                << std::endl;
+    }
+  }
+  finishSection();
+  return true;
+}
+
+bool ProfileDb::save(const std::string &path) const {
+  std::ofstream file(path);
+  if (!file.is_open()) {
+    std::cerr << "Erreur: Impossible d'ecrire " << path << std::endl;
+    return false;
+  }
+
+  file << "# Profils des ROMs par empreinte (mis a jour par chip8)\n";
+  for (const auto &entry : profiles) {
+    const RomProfile &profile = entry.second;
+    file << "\n[" << hashToString(entry.first) << "]\n";
+    if (!profile.name.empty())
+      file << "name = " << profile.name << "\n";
+    file << "ips = " << profile.instructionsPerSecond << "\n";
+    if (!profile.variant.empty())
+      file << "variant = " << profile.variant << "\n";
+
+    std::string quirks;
+    for (const auto &quirk : QUIRK_NAMES) {
+      if (profile.quirks.*quirk.flag)
+        quirks += (quirks.empty() ? "" : ", ") + std::string(quirk.name);
+    }
+    file << "quirks = " << quirks << "\n";
+    file << "palette = " << profile.palette << "\n";
+    if (!profile.keys.empty())
+      file << "keys = " << profile.keys << "\n";
+  }
+  return true;
+}
+
+const RomProfile *ProfileDb::find(uint64_t hash) const {
+  auto it = profiles.find(hash);
+  return it != profiles.end() ? &it->second : nullptr;
+}
+
+void ProfileDb::set(uint64_t hash, const RomProfile &profile) {
+  profiles[hash] = profile;
+}
+
+uint64_t hashLoadedRom(const Chip8 &chip8) {
+  std::vector<uint8_t> rom(chip8.getRomSize());
+  for (size_t i = 0; i < rom.size(); ++i) {
+    rom[i] = chip8.peek(static_cast<uint16_t>(Chip8::START_ADDRESS + i));
+  }
+  return hashRom(rom.data(), rom.size());
+}
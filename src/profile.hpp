@@ -0,0 +1,55 @@
+#ifndef PROFILE_HPP
+#define PROFILE_HPP
+
+#include "chip8.hpp"
+#include <cstdint>
+#include <map>
+#include <string>
+
+// Reglages d'une ROM, retrouves par empreinte de son contenu
+struct RomProfile {
+  // Plage de vitesse, la meme que celle des touches +/-
+  static constexpr int MIN_IPS = 100;
+  static constexpr int MAX_IPS = 2000;
+  // Palettes F1/F2 du frontend
+  static constexpr int NUM_PALETTES = 5;
+
+  std::string name; // Indicatif, pour s'y retrouver dans le fichier
+  int instructionsPerSecond = 500;
+  std::string variant; // "chip8", "schip" ou vide (defauts de l'emulateur)
+  Chip8::Quirks quirks;
+  int palette = 0;  // Index dans les palettes F1/F2
+  std::string keys; // Touches du clavier pour 0-F (vide = par defaut)
+};
+
+// Fichier de profils, une section par ROM :
+//
+//   [a3f1c2d4e5b60718]
+//   name = pong
+//   ips = 700
+//   variant = chip8
+//   quirks = vf-reset, shift-vy, memory-i, jump-vx, clip
+//   palette = 1
+//   keys = x123qweasdzc4rfv
+//
+// Sans ligne quirks, les quirks sont ceux de la variante.
+class ProfileDb {
+public:
+  // Faux si le fichier est absent ou illisible (la base reste vide)
+  bool load(const std::string &path);
+  bool save(const std::string &path) const;
+
+  const RomProfile *find(uint64_t hash) const;
+  void set(uint64_t hash, const RomProfile &profile);
+
+private:
+  std::map<uint64_t, RomProfile> profiles;
+};
+
+// Quirks d'une variante ; faux si elle est inconnue
+bool quirksForVariant(const std::string &variant, Chip8::Quirks &quirks);
+
+// Empreinte (hashRom) de la ROM chargee dans chip8
+uint64_t hashLoadedRom(const Chip8 &chip8);
+
+#endif // PROFILE_HPP
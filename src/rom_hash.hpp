@@ -0,0 +1,14 @@
+#ifndef ROM_HASH_HPP
+#define ROM_HASH_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// Empreinte du contenu d'une ROM (FNV-1a 64 bits)
+uint64_t hashRom(const uint8_t *data, size_t size);
+
+// Forme hexadecimale sur 16 caracteres
+std::string hashToString(uint64_t hash);
+
+#endif // ROM_HASH_HPP
@@ -0,0 +1,192 @@
+#include "sdl_display.hpp"
+#include "latency.hpp"
+#include <algorithm>
+#include <iostream>
+
+SdlDisplay::SdlDisplay() : scale(10) {}
+
+SdlDisplay::~SdlDisplay() { cleanup(); }
+
+bool SdlDisplay::init(int scale) { return initGrid(1, 1, scale); }
+
+bool SdlDisplay::initGrid(int columns, int rows, int scale) {
+  this->scale = scale;
+  gridColumns = columns;
+  gridRows = rows;
+
+  if (SDL_Init(SDL_INIT_VIDEO) < 0) {
+    std::cerr << "SDL Init Error: " << SDL_GetError() << std::endl;
+    return false;
+  }
+
+  window = SDL_CreateWindow("CHIP-8 Emulator", SDL_WINDOWPOS_CENTERED,
+                            SDL_WINDOWPOS_CENTERED, columns * WIDTH * scale,
+                            rows * HEIGHT * scale, SDL_WINDOW_SHOWN);
+
+  if (!window) {
+    std::cerr << "Window Error: " << SDL_GetError() << std::endl;
+    return false;
+  }
+
+  renderer = SDL_CreateRenderer(window, -1, SDL_RENDERER_ACCELERATED);
+  if (!renderer) {
+    std::cerr << "Renderer Error: " << SDL_GetError() << std::endl;
+    return false;
+  }
+
+  texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888,
+                              SDL_TEXTUREACCESS_STREAMING, columns * WIDTH,
+                              rows * HEIGHT);
+
+  if (!texture) {
+    std::cerr << "Texture Error: " << SDL_GetError() << std::endl;
+    return false;
+  }
+
+  return true;
+}
+
+void SdlDisplay::setTitle(const std::string &title) {
+  if (window) {
+    SDL_SetWindowTitle(window, title.c_str());
+  }
+}
+
+void SdlDisplay::setColors(uint32_t fg, uint32_t bg) {
+  fgColor = fg;
+  bgColor = bg;
+}
+
+void SdlDisplay::render(const uint8_t *framebuffer) {
+  uint32_t pixels[WIDTH * HEIGHT];
+
+  for (int i = 0; i < WIDTH * HEIGHT; ++i) {
+    pixels[i] = framebuffer[i] ? fgColor : bgColor;
+  }
+
+  SDL_UpdateTexture(texture, nullptr, pixels, WIDTH * sizeof(uint32_t));
+  SDL_RenderClear(renderer);
+  SDL_RenderCopy(renderer, texture, nullptr, nullptr);
+  SDL_RenderPresent(renderer);
+
+  if (latency) {
+    latency->onPresent();
+  }
+}
+
+void SdlDisplay::renderTiles(const uint8_t *const *framebuffers,
+                             const uint8_t *changed, int count) {
+  uint32_t pixels[WIDTH * HEIGHT];
+  count = std::min(count, gridColumns * gridRows);
+
+  for (int t = 0; t < count; ++t) {
+    if (!changed[t]) {
+      continue;
+    }
+    for (int i = 0; i < WIDTH * HEIGHT; ++i) {
+      pixels[i] = framebuffers[t][i] ? fgColor : bgColor;
+    }
+    SDL_Rect tile = {(t % gridColumns) * WIDTH, (t / gridColumns) * HEIGHT,
+                     WIDTH, HEIGHT};
+    SDL_UpdateTexture(texture, &tile, pixels, WIDTH * sizeof(uint32_t));
+  }
+
+  // Les tuiles non recopiees gardent leur contenu dans la texture
+  SDL_RenderClear(renderer);
+  SDL_RenderCopy(renderer, texture, nullptr, nullptr);
+  SDL_RenderPresent(renderer);
+
+  if (latency) {
+    latency->onPresent();
+  }
+}
+
+void SdlDisplay::cleanup() {
+  if (texture) {
+    SDL_DestroyTexture(texture);
+    texture = nullptr;
+  }
+  if (renderer) {
+    SDL_DestroyRenderer(renderer);
+    renderer = nullptr;
+  }
+  if (window) {
+    SDL_DestroyWindow(window);
+    window = nullptr;
+  }
+  SDL_Quit();
+}
+
+InputEvent SdlDisplay::processEvents(uint8_t *keypad) {
+  SDL_Event event;
+
+  while (SDL_PollEvent(&event)) {
+    switch (event.type) {
+    case SDL_QUIT:
+      return InputEvent::Quit;
+
+    case SDL_WINDOWEVENT:
+      // Plusieurs fenetres : SDL_QUIT n'arrive qu'a la fermeture de la
+      // derniere, on traite donc la fermeture de chacune
+      if (event.window.event == SDL_WINDOWEVENT_CLOSE) {
+        if (window && event.window.windowID == SDL_GetWindowID(window))
+          return InputEvent::Quit;
+        return InputEvent::DebugView;
+      }
+      break;
+
+    case SDL_KEYDOWN: {
+      SDL_Keycode sym = event.key.keysym.sym;
+
+      // Touches CHIP-8 d'abord : la disposition d'un profil peut reprendre
+      // Espace, +, - ou 6 (Echap et les touches F n'y figurent jamais)
+      int key = chip8Key(sym);
+      if (key >= 0) {
+        if (latency && !event.key.repeat) {
+          latency->onKeyEvent(key);
+        }
+        keypad[key] = 1;
+        break;
+      }
+
+      // Touches speciales
+      if (sym == SDLK_ESCAPE)
+        return InputEvent::Quit;
+      if (sym == SDLK_SPACE)
+        return InputEvent::Pause;
+      if (sym == SDLK_F5)
+        return InputEvent::Reset;
+      if (sym == SDLK_F1)
+        return InputEvent::ColorPrev;
+      if (sym == SDLK_F2)
+        return InputEvent::ColorNext;
+      if (sym == SDLK_EQUALS || sym == SDLK_PLUS || sym == SDLK_KP_PLUS)
+        return InputEvent::SpeedUp;
+      if (sym == SDLK_MINUS || sym == SDLK_KP_MINUS || sym == SDLK_6)
+        return InputEvent::SpeedDown;
+      if (sym == SDLK_F6)
+        return InputEvent::DebugBreak;
+      if (sym == SDLK_F7)
+        return InputEvent::DebugStep;
+      if (sym == SDLK_F9)
+        return InputEvent::DebugBreakpoint;
+      if (sym == SDLK_F10)
+        return InputEvent::DebugView;
+      break;
+    }
+
+    case SDL_KEYUP: {
+      int key = chip8Key(event.key.keysym.sym);
+      if (key >= 0) {
+        if (latency) {
+          latency->onKeyEvent(key);
+        }
+        keypad[key] = 0;
+      }
+      break;
+    }
+    }
+  }
+
+  return InputEvent::None;
+}
@@ -0,0 +1,37 @@
+#ifndef SDL_DISPLAY_HPP
+#define SDL_DISPLAY_HPP
+
+#include "display.hpp"
+#include <SDL2/SDL.h>
+
+class SdlDisplay : public Display {
+public:
+  SdlDisplay();
+  ~SdlDisplay() override;
+
+  bool init(int scale = 10) override;
+  // Fenetre en grille de columns x rows ecrans (mode mur)
+  bool initGrid(int columns, int rows, int scale);
+  void render(const uint8_t *framebuffer) override;
+  // Compose les ecrans de la grille (ordre ligne par ligne) ; seules les
+  // tuiles marquees changed sont recopiees dans la texture
+  void renderTiles(const uint8_t *const *framebuffers, const uint8_t *changed,
+                   int count);
+  void cleanup();
+  InputEvent processEvents(uint8_t *keypad) override;
+  void setTitle(const std::string &title) override;
+  void setColors(uint32_t fg, uint32_t bg) override;
+  SDL_Renderer *getRenderer() { return renderer; }
+
+private:
+  SDL_Window *window = nullptr;
+  SDL_Renderer *renderer = nullptr;
+  SDL_Texture *texture = nullptr;
+  int scale;
+  int gridColumns = 1;
+  int gridRows = 1;
+  uint32_t fgColor = 0xFFFFFFFF;
+  uint32_t bgColor = 0x000000FF;
+};
+
+#endif // SDL_DISPLAY_HPP
@@ -0,0 +1,129 @@
+#include "shm_frame.hpp"
+#include <cstring>
+#include <fcntl.h>
+#include <iostream>
+#include <new>
+#include <sys/mman.h>
+#include <thread>
+#include <unistd.h>
+
+// shm_open veut un nom de la forme "/nom"
+static std::string shmName(const std::string &name) {
+  return name.empty() || name[0] != '/' ? "/" + name : name;
+}
+
+ShmPublisher::ShmPublisher(const std::string &name) : name(shmName(name)) {
+  int fd = shm_open(this->name.c_str(), O_CREAT | O_RDWR, 0600);
+  if (fd < 0) {
+    std::cerr << "Erreur: shm_open " << this->name << std::endl;
+    return;
+  }
+
+  void *memory = MAP_FAILED;
+  if (ftruncate(fd, sizeof(SharedFrame)) == 0) {
+    memory = mmap(nullptr, sizeof(SharedFrame), PROT_READ | PROT_WRITE,
+                  MAP_SHARED, fd, 0);
+  }
+  close(fd);
+  if (memory == MAP_FAILED) {
+    std::cerr << "Erreur: mmap " << this->name << std::endl;
+    shm_unlink(this->name.c_str());
+    return;
+  }
+
+  shared = new (memory) SharedFrame{};
+  shared->magic = SharedFrame::MAGIC;
+  shared->version = SharedFrame::VERSION;
+}
+
+ShmPublisher::~ShmPublisher() {
+  if (shared) {
+    shared->~SharedFrame();
+    munmap(shared, sizeof(SharedFrame));
+    shm_unlink(name.c_str());
+  }
+}
+
+void ShmPublisher::publish(const Chip8 &chip8) {
+  FrameState &state = shared->state;
+  uint32_t seq = shared->sequence.load(std::memory_order_relaxed);
+
+  shared->sequence.store(seq + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+
+  state.frame = ++frameCount;
+  state.pc = chip8.getPC();
+  state.I = chip8.getI();
+  state.sp = chip8.getSP();
+  state.delayTimer = chip8.getDelayTimer();
+  state.soundTimer = chip8.getSoundTimer();
+  for (int i = 0; i < Chip8::NUM_REGISTERS; ++i) {
+    state.V[i] = chip8.getV(i);
+  }
+  std::memcpy(state.pixels, chip8.display.data(), sizeof(state.pixels));
+
+  shared->sequence.store(seq + 2, std::memory_order_release);
+}
+
+void ShmPublisher::pollInput(uint8_t *keypad) {
+  uint8_t event;
+  while (shared->input.pop(event)) {
+    keypad[event & 0x0F] = (event & 0x80) ? 1 : 0;
+  }
+}
+
+ShmReader::~ShmReader() {
+  if (shared) {
+    munmap(shared, sizeof(SharedFrame));
+  }
+}
+
+bool ShmReader::open(const std::string &name) {
+  int fd = shm_open(shmName(name).c_str(), O_RDWR, 0);
+  if (fd < 0) {
+    return false;
+  }
+
+  void *memory = mmap(nullptr, sizeof(SharedFrame), PROT_READ | PROT_WRITE,
+                      MAP_SHARED, fd, 0);
+  close(fd);
+  if (memory == MAP_FAILED) {
+    return false;
+  }
+
+  shared = static_cast<SharedFrame *>(memory);
+  if (shared->magic != SharedFrame::MAGIC ||
+      shared->version != SharedFrame::VERSION) {
+    munmap(shared, sizeof(SharedFrame));
+    shared = nullptr;
+    return false;
+  }
+  return true;
+}
+
+bool ShmReader::read(FrameState &state) const {
+  auto deadline = std::chrono::steady_clock::now() + READ_TIMEOUT;
+
+  while (true) {
+    uint32_t before = shared->sequence.load(std::memory_order_acquire);
+    if ((before & 1) == 0) {
+      std::memcpy(&state, &shared->state, sizeof(state));
+
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (shared->sequence.load(std::memory_order_relaxed) == before) {
+        return true;
+      }
+    }
+
+    // Ecriture en cours : on laisse la main au publieur
+    if (std::chrono::steady_clock::now() >= deadline) {
+      return false;
+    }
+    std::this_thread::yield();
+  }
+}
+
+bool ShmReader::sendKey(int key, bool pressed) {
+  uint8_t event = static_cast<uint8_t>((key & 0x0F) | (pressed ? 0x80 : 0));
+  return shared->input.push(event);
+}
@@ -0,0 +1,91 @@
+#ifndef SHM_FRAME_HPP
+#define SHM_FRAME_HPP
+
+#include "chip8.hpp"
+#include "spsc_ring.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+// Segment de memoire partagee POSIX publie par --shm NAME : la derniere
+// frame et l'etat du CPU, proteges par un seqlock, plus une file de
+// touches en sens inverse. Les outils locaux (overlays, streaming, bots)
+// le lisent sans appel systeme ni copie par socket.
+
+// Etat publie a chaque frame
+struct FrameState {
+  uint64_t frame; // Compteur de frames depuis le lancement
+  uint16_t pc;
+  uint16_t I;
+  uint8_t sp;
+  uint8_t delayTimer;
+  uint8_t soundTimer;
+  uint8_t V[Chip8::NUM_REGISTERS];
+  uint8_t pixels[Chip8::DISPLAY_WIDTH * Chip8::DISPLAY_HEIGHT];
+};
+
+// Les atomiques du segment sont partages entre processus : valable
+// seulement s'ils ne reposent pas sur un verrou interne au processus
+static_assert(std::atomic<uint32_t>::is_always_lock_free,
+              "std::atomic<uint32_t> doit etre sans verrou");
+static_assert(std::atomic<size_t>::is_always_lock_free,
+              "std::atomic<size_t> doit etre sans verrou (SpscRing)");
+
+struct SharedFrame {
+  static constexpr uint32_t MAGIC = 0x48533843; // "C8SH"
+  static constexpr uint32_t VERSION = 1;
+
+  uint32_t magic;
+  uint32_t version;
+
+  // Seqlock : impair pendant une ecriture
+  std::atomic<uint32_t> sequence;
+  FrameState state;
+
+  // Touches envoyees par un outil (un seul producteur) :
+  // bits 0-3 = touche, bit 7 = enfoncee
+  SpscRing<uint8_t, 64> input;
+};
+
+// Cote emulateur : cree le segment et le met a jour
+class ShmPublisher {
+public:
+  explicit ShmPublisher(const std::string &name);
+  ~ShmPublisher(); // Supprime le segment
+
+  bool isOpen() const { return shared != nullptr; }
+
+  // Publie l'ecran et les registres (une fois par frame)
+  void publish(const Chip8 &chip8);
+
+  // Applique les touches recues au clavier virtuel
+  void pollInput(uint8_t *keypad);
+
+private:
+  std::string name;
+  SharedFrame *shared = nullptr;
+  uint64_t frameCount = 0;
+};
+
+// Cote outil : s'attache a un segment existant
+class ShmReader {
+public:
+  ~ShmReader();
+
+  bool open(const std::string &name);
+
+  // Copie coherente de la derniere frame : reessaie tant qu'une ecriture
+  // est en cours, faux au bout de READ_TIMEOUT (emulateur arrete au
+  // milieu d'une publication)
+  bool read(FrameState &state) const;
+  static constexpr std::chrono::milliseconds READ_TIMEOUT{100};
+
+  // Faux si la file est pleine
+  bool sendKey(int key, bool pressed);
+
+private:
+  SharedFrame *shared = nullptr;
+};
+
+#endif // SHM_FRAME_HPP
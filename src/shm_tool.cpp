@@ -0,0 +1,72 @@
+#include "shm_frame.hpp"
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <thread>
+
+// chip8-shm : exemple de lecteur du segment publie par chip8 --shm NAME.
+// Affiche les frames en ASCII ; --key K appuie brievement sur une touche.
+int main(int argc, char *argv[]) {
+  std::string name;
+  long frames = 1;
+  int key = -1;
+
+  for (int i = 1; i < argc; ++i) {
+    std::string arg = argv[i];
+    if (arg == "--frames" && i + 1 < argc) {
+      frames = std::stol(argv[++i]);
+    } else if (arg == "--key" && i + 1 < argc) {
+      key = std::stoi(argv[++i], nullptr, 16);
+    } else if (name.empty()) {
+      name = arg;
+    } else {
+      name.clear();
+      break;
+    }
+  }
+
+  if (name.empty()) {
+    std::cerr << "Usage: chip8-shm <nom> [--frames N] [--key K]" << std::endl;
+    return 1;
+  }
+
+  ShmReader reader;
+  if (!reader.open(name)) {
+    std::cerr << "Erreur: segment " << name << " introuvable" << std::endl;
+    return 1;
+  }
+
+  if (key >= 0) {
+    reader.sendKey(key, true);
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    reader.sendKey(key, false);
+  }
+
+  FrameState state;
+  uint64_t last = 0;
+  for (long shown = 0; shown < frames;) {
+    if (!reader.read(state)) {
+      std::cerr << "Erreur: publication interrompue (emulateur arrete ?)"
+                << std::endl;
+      return 1;
+    }
+    if (state.frame == last) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      continue;
+    }
+    last = state.frame;
+    ++shown;
+
+    std::printf("frame %llu  PC=%03X I=%03X SP=%u DT=%u ST=%u\n",
+                static_cast<unsigned long long>(state.frame), state.pc,
+                state.I, state.sp, state.delayTimer, state.soundTimer);
+    for (int y = 0; y < Chip8::DISPLAY_HEIGHT; ++y) {
+      for (int x = 0; x < Chip8::DISPLAY_WIDTH; ++x) {
+        std::putchar(state.pixels[y * Chip8::DISPLAY_WIDTH + x] ? '#' : '.');
+      }
+      std::putchar('\n');
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,42 @@
+#ifndef SPSC_RING_HPP
+#define SPSC_RING_HPP
+
+#include <atomic>
+#include <cstddef>
+
+// File circulaire sans verrou, un producteur et un consommateur.
+// Capacity doit etre une puissance de 2.
+template <typename T, size_t Capacity> class SpscRing {
+  static_assert((Capacity & (Capacity - 1)) == 0,
+                "Capacity doit etre une puissance de 2");
+
+public:
+  // Producteur : faux si la file est pleine
+  bool push(const T &item) {
+    size_t head = writeIndex.load(std::memory_order_relaxed);
+    if (head - readIndex.load(std::memory_order_acquire) == Capacity) {
+      return false;
+    }
+    items[head & (Capacity - 1)] = item;
+    writeIndex.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Consommateur : faux si la file est vide
+  bool pop(T &item) {
+    size_t tail = readIndex.load(std::memory_order_relaxed);
+    if (tail == writeIndex.load(std::memory_order_acquire)) {
+      return false;
+    }
+    item = items[tail & (Capacity - 1)];
+    readIndex.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+private:
+  T items[Capacity];
+  alignas(64) std::atomic<size_t> writeIndex{0};
+  alignas(64) std::atomic<size_t> readIndex{0};
+};
+
+#endif // SPSC_RING_HPP
@@ -0,0 +1,263 @@
+#include "terminal_display.hpp"
+#include "latency.hpp"
+#include <cctype>
+#include <cstdio>
+#include <fcntl.h>
+#include <iostream>
+#include <unistd.h>
+#include <utility>
+
+// Glyphes indexes par (haut | bas << 1)
+static const char *const HALF_BLOCKS[4] = {" ", "▀", "▄", "█"};
+
+TerminalDisplay::~TerminalDisplay() { cleanup(); }
+
+bool TerminalDisplay::init(int) {
+  if (!isatty(STDIN_FILENO) || !isatty(STDOUT_FILENO)) {
+    std::cerr << "Erreur: --term demande un terminal" << std::endl;
+    return false;
+  }
+
+  // Mode brut : pas d'echo, lecture octet par octet et non bloquante
+  if (tcgetattr(STDIN_FILENO, &savedTermios) != 0) {
+    return false;
+  }
+  termios raw = savedTermios;
+  raw.c_lflag &= ~(ICANON | ECHO | ISIG | IEXTEN);
+  raw.c_iflag &= ~(IXON | ICRNL);
+  raw.c_cc[VMIN] = 0;
+  raw.c_cc[VTIME] = 0;
+  tcsetattr(STDIN_FILENO, TCSANOW, &raw);
+  savedFlags = fcntl(STDIN_FILENO, F_GETFL);
+  fcntl(STDIN_FILENO, F_SETFL, savedFlags | O_NONBLOCK);
+  active = true;
+
+  // Ecran alternatif, curseur masque
+  write("\033[?1049h\033[?25l");
+  fullRepaint = true;
+  return true;
+}
+
+void TerminalDisplay::cleanup() {
+  if (!active) {
+    return;
+  }
+  write("\033[0m\033[?25h\033[?1049l");
+  fcntl(STDIN_FILENO, F_SETFL, savedFlags);
+  tcsetattr(STDIN_FILENO, TCSANOW, &savedTermios);
+  active = false;
+
+  if (frames > 0) {
+    std::cerr << "Terminal: " << frames << " frames, "
+              << bytesWritten / frames << " octets/frame en moyenne"
+              << std::endl;
+  }
+}
+
+void TerminalDisplay::write(const std::string &data) {
+  size_t offset = 0;
+  while (offset < data.size()) {
+    ssize_t written =
+        ::write(STDOUT_FILENO, data.data() + offset, data.size() - offset);
+    if (written <= 0) {
+      break;
+    }
+    offset += static_cast<size_t>(written);
+  }
+  bytesWritten += offset;
+}
+
+std::string TerminalDisplay::colorSequence() const {
+  // Couleurs RGBA8888 en "true color"
+  char buf[48];
+  std::snprintf(buf, sizeof(buf), "\033[38;2;%u;%u;%u;48;2;%u;%u;%um",
+                (fgColor >> 24) & 0xFF, (fgColor >> 16) & 0xFF,
+                (fgColor >> 8) & 0xFF, (bgColor >> 24) & 0xFF,
+                (bgColor >> 16) & 0xFF, (bgColor >> 8) & 0xFF);
+  return buf;
+}
+
+void TerminalDisplay::setTitle(const std::string &title) {
+  if (active) {
+    write("\033]0;" + title + "\007");
+  }
+}
+
+void TerminalDisplay::setColors(uint32_t fg, uint32_t bg) {
+  fgColor = fg;
+  bgColor = bg;
+  fullRepaint = true;
+}
+
+void TerminalDisplay::render(const uint8_t *framebuffer) {
+  uint64_t current[HEIGHT];
+  for (int y = 0; y < HEIGHT; ++y) {
+    uint64_t bits = 0;
+    for (int x = 0; x < WIDTH; ++x) {
+      bits |= static_cast<uint64_t>(framebuffer[y * WIDTH + x] != 0) << x;
+    }
+    current[y] = bits;
+  }
+
+  std::string out;
+  if (fullRepaint) {
+    out = colorSequence() + "\033[2J";
+  }
+
+  char move[16];
+  for (int row = 0; row < HEIGHT / 2; ++row) {
+    const uint64_t top = current[2 * row];
+    const uint64_t bottom = current[2 * row + 1];
+    uint64_t changed = fullRepaint ? ~0ull
+                                   : (top ^ rows[2 * row]) |
+                                         (bottom ^ rows[2 * row + 1]);
+    int cursor = -1; // Colonne du curseur, -1 = inconnue
+
+    while (changed) {
+      int x = __builtin_ctzll(changed);
+
+      // Un deplacement coute ~8 octets : on reecrit plutot les cellules
+      // inchangees d'un petit trou (1 a 3 octets chacune)
+      if (cursor < 0 || x - cursor > 2) {
+        std::snprintf(move, sizeof(move), "\033[%d;%dH", row + 1, x + 1);
+        out += move;
+        cursor = x;
+      }
+      for (; cursor <= x; ++cursor) {
+        int cell = ((top >> cursor) & 1) | (((bottom >> cursor) & 1) << 1);
+        out += HALF_BLOCKS[cell];
+      }
+      changed &= changed - 1;
+    }
+  }
+
+  for (int y = 0; y < HEIGHT; ++y) {
+    rows[y] = current[y];
+  }
+  fullRepaint = false;
+  ++frames;
+
+  if (!out.empty()) {
+    write(out);
+  }
+  if (latency) {
+    latency->onPresent();
+  }
+}
+
+void TerminalDisplay::pressKey(uint8_t *keypad, int key) {
+  auto now = Clock::now();
+  if (!keypad[key]) {
+    if (latency) {
+      latency->onKeyEvent(key);
+    }
+    keypad[key] = 1;
+    releaseAt[key] = now + FIRST_HOLD;
+  } else {
+    releaseAt[key] = now + REPEAT_HOLD;
+  }
+}
+
+InputEvent TerminalDisplay::processEvents(uint8_t *keypad) {
+  // Relachement implicite des touches sans repetition recente
+  auto now = Clock::now();
+  for (int key = 0; key < 16; ++key) {
+    if (keypad[key] && now >= releaseAt[key]) {
+      if (latency) {
+        latency->onKeyEvent(key);
+      }
+      keypad[key] = 0;
+    }
+  }
+
+  char buf[64];
+  ssize_t count = ::read(STDIN_FILENO, buf, sizeof(buf));
+  if (count <= 0) {
+    // Sequence restee incomplete : Echap seul, ou debut de sequence perdu
+    if (!pendingEscape.empty() && now - pendingSince >= ESCAPE_TIMEOUT) {
+      bool bare = pendingEscape.size() == 1;
+      pendingEscape.clear();
+      if (bare)
+        return InputEvent::Quit;
+    }
+    return InputEvent::None;
+  }
+  bool resumed = !pendingEscape.empty();
+  std::string input = std::move(pendingEscape);
+  input.append(buf, static_cast<size_t>(count));
+  pendingEscape.clear();
+
+  // Touches de fonction (xterm) : ESC O P, ESC [ 1 5 ~, ...
+  static const struct {
+    const char *sequence;
+    InputEvent event;
+  } SEQUENCES[] = {
+      {"\033OP", InputEvent::ColorPrev},         // F1
+      {"\033OQ", InputEvent::ColorNext},         // F2
+      {"\033[15~", InputEvent::Reset},           // F5
+      {"\033[17~", InputEvent::DebugBreak},      // F6
+      {"\033[18~", InputEvent::DebugStep},       // F7
+      {"\033[20~", InputEvent::DebugBreakpoint}, // F9
+      {"\033[21~", InputEvent::DebugView},       // F10
+  };
+
+  InputEvent result = InputEvent::None;
+  for (size_t i = 0; i < input.size(); ++i) {
+    char c = input[i];
+
+    if (c == '\033') {
+      bool matched = false;
+      for (const auto &seq : SEQUENCES) {
+        if (input.compare(i, std::char_traits<char>::length(seq.sequence),
+                          seq.sequence) == 0) {
+          result = seq.event;
+          i += std::char_traits<char>::length(seq.sequence) - 1;
+          matched = true;
+          break;
+        }
+      }
+      if (matched)
+        continue;
+
+      // Fin de lecture au milieu d'une sequence : la suite est attendue
+      size_t end = i + 1;
+      if (end < input.size() && input[end] == 'O') {
+        end += 1;
+      } else if (end < input.size() && input[end] == '[') {
+        ++end;
+        while (end < input.size() &&
+               !std::isalpha(static_cast<unsigned char>(input[end])) &&
+               input[end] != '~')
+          ++end;
+      }
+      if (end >= input.size()) {
+        if (!(resumed && i == 0))
+          pendingSince = now;
+        pendingEscape = input.substr(i);
+        break;
+      }
+      // Sequence inconnue, ignoree en entier jusqu'a sa lettre finale (qui
+      // n'est pas une touche CHIP-8) : SS3 ESC O x (F1-F4, fleches en mode
+      // application), CSI ESC [ parametres finale (fleches, F5-F12...),
+      // ou Alt + touche
+      i = end;
+      continue;
+    }
+
+    if (c == 0x03) // Ctrl+C (ISIG desactive)
+      return InputEvent::Quit;
+    // Comme SdlDisplay : la disposition du clavier passe avant les
+    // raccourcis
+    int key = chip8Key(static_cast<unsigned char>(c));
+    if (key >= 0)
+      pressKey(keypad, key);
+    else if (c == ' ')
+      result = InputEvent::Pause;
+    else if (c == '+' || c == '=')
+      result = InputEvent::SpeedUp;
+    else if (c == '-' || c == '6')
+      result = InputEvent::SpeedDown;
+  }
+
+  return result;
+}
@@ -0,0 +1,58 @@
+#ifndef TERMINAL_DISPLAY_HPP
+#define TERMINAL_DISPLAY_HPP
+
+#include "display.hpp"
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <termios.h>
+
+// Affichage dans un terminal ANSI (SSH, machines sans ecran) : deux pixels
+// par caractere avec les demi-blocs Unicode, 64x16 cellules. Chaque ligne
+// de l'ecran CHIP-8 tient dans un mot de 64 bits ; seules les cellules
+// dont un des deux mots a change sont reecrites.
+class TerminalDisplay : public Display {
+public:
+  TerminalDisplay() = default;
+  ~TerminalDisplay() override;
+
+  bool init(int scale = 10) override; // scale ignore
+  void render(const uint8_t *framebuffer) override;
+  InputEvent processEvents(uint8_t *keypad) override;
+  void setTitle(const std::string &title) override;
+  void setColors(uint32_t fg, uint32_t bg) override;
+  void cleanup();
+
+private:
+  using Clock = std::chrono::steady_clock;
+
+  // Un terminal ne signale pas le relachement d'une touche : elle reste
+  // enfoncee jusqu'a cette echeance, prolongee par la repetition auto
+  static constexpr auto FIRST_HOLD = std::chrono::milliseconds(500);
+  static constexpr auto REPEAT_HOLD = std::chrono::milliseconds(100);
+  // Une sequence d'echappement peut arriver en deux lectures (SSH lent) :
+  // ESC n'est un Echap seul que si rien ne le suit dans ce delai
+  static constexpr auto ESCAPE_TIMEOUT = std::chrono::milliseconds(50);
+
+  bool active = false;
+  termios savedTermios{};
+  int savedFlags = 0;
+
+  uint64_t rows[HEIGHT] = {};  // Derniere image affichee, bit x = pixel x
+  bool fullRepaint = true;
+  uint32_t fgColor = 0xFFFFFFFF;
+  uint32_t bgColor = 0x000000FF;
+  Clock::time_point releaseAt[16] = {};
+  std::string pendingEscape; // Debut de sequence en attente de la suite
+  Clock::time_point pendingSince;
+
+  // Statistiques (affichees a la fermeture)
+  uint64_t bytesWritten = 0;
+  uint64_t frames = 0;
+
+  std::string colorSequence() const;
+  void write(const std::string &data);
+  void pressKey(uint8_t *keypad, int key);
+};
+
+#endif // TERMINAL_DISPLAY_HPP
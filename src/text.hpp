@@ -0,0 +1,12 @@
+#ifndef TEXT_HPP
+#define TEXT_HPP
+
+#include <SDL2/SDL.h>
+#include <string>
+
+// Dessine du texte avec la font bitmap 5x7 et la couleur courante du
+// renderer. Chaque caractere occupe 6x8 pixels avant mise a l'echelle.
+void renderText(SDL_Renderer *renderer, const std::string &text, int x, int y,
+                int scale);
+
+#endif // TEXT_HPP
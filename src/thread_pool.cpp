@@ -0,0 +1,58 @@
+#include "thread_pool.hpp"
+
+ThreadPool::ThreadPool(size_t threads) {
+  if (threads == 0) {
+    threads = 1;
+  }
+  for (size_t i = 0; i < threads; ++i) {
+    workers.emplace_back(&ThreadPool::workerLoop, this);
+  }
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    stopping = true;
+    tasks.clear();
+  }
+  available.notify_all();
+
+  for (auto &worker : workers) {
+    worker.join();
+  }
+}
+
+void ThreadPool::submit(std::function<void()> task) {
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    tasks.push_back(std::move(task));
+  }
+  available.notify_one();
+}
+
+void ThreadPool::wait() {
+  std::unique_lock<std::mutex> lock(mutex);
+  idle.wait(lock, [this] { return tasks.empty() && active == 0; });
+}
+
+void ThreadPool::workerLoop() {
+  while (true) {
+    std::function<void()> task;
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      available.wait(lock, [this] { return stopping || !tasks.empty(); });
+      if (stopping) {
+        return;
+      }
+      task = std::move(tasks.front());
+      tasks.pop_front();
+      ++active;
+    }
+    task();
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if (--active == 0 && tasks.empty()) {
+      idle.notify_all();
+    }
+  }
+}
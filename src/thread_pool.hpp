@@ -0,0 +1,34 @@
+#ifndef THREAD_POOL_HPP
+#define THREAD_POOL_HPP
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Pool de threads simple : file FIFO de taches
+class ThreadPool {
+public:
+  explicit ThreadPool(size_t threads);
+  ~ThreadPool(); // Abandonne les taches en attente, attend les taches en cours
+
+  void submit(std::function<void()> task);
+  // Attend que la file soit vide et qu'aucune tache ne soit en cours
+  void wait();
+  size_t size() const { return workers.size(); }
+
+private:
+  std::vector<std::thread> workers;
+  std::deque<std::function<void()>> tasks;
+  std::mutex mutex;
+  std::condition_variable available;
+  std::condition_variable idle;
+  size_t active = 0; // Taches en cours d'execution
+  bool stopping = false;
+
+  void workerLoop();
+};
+
+#endif // THREAD_POOL_HPP
@@ -0,0 +1,58 @@
+#include "timing.hpp"
+
+namespace vip {
+
+int cycleCost(uint16_t opcode) {
+  unsigned x = (opcode >> 8) & 0x0F;
+  unsigned nn = opcode & 0xFF;
+
+  switch (opcode & 0xF000) {
+  case 0x0000:
+    return opcode == 0x00E0 ? 109 : 105; // CLS / RET
+  case 0x1000: // JP
+  case 0x2000: // CALL
+  case 0xB000: // JP V0
+    return 105;
+  case 0x3000: // SE Vx, byte
+  case 0x4000: // SNE Vx, byte
+    return 55;
+  case 0x5000: // SE Vx, Vy
+  case 0x9000: // SNE Vx, Vy
+    return 73;
+  case 0x6000: // LD Vx, byte
+    return 27;
+  case 0x7000: // ADD Vx, byte
+    return 45;
+  case 0x8000: // Arithmetique (routine commune)
+    return 200;
+  case 0xA000: // LD I
+    return 55;
+  case 0xC000: // RND
+    return 164;
+  case 0xD000: // DRW : le reste de la frame est perdu a attendre
+    return 2000;
+  case 0xE000: // SKP / SKNP
+    return 73;
+  case 0xF000:
+    switch (nn) {
+    case 0x07:
+    case 0x0A:
+    case 0x15:
+    case 0x18:
+      return 45;
+    case 0x1E:
+      return 86;
+    case 0x29:
+      return 91;
+    case 0x33:
+      return 927;
+    case 0x55:
+    case 0x65:
+      return 82 + 64 * (x + 1);
+    }
+    break;
+  }
+  return 45;
+}
+
+} // namespace vip
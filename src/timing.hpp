@@ -0,0 +1,47 @@
+#ifndef TIMING_HPP
+#define TIMING_HPP
+
+#include "chip8.hpp"
+#include <cstdint>
+
+// Modele de timing du COSMAC VIP (interpreteur CHIP-8 d'origine).
+// Les couts sont des durees approximatives en microsecondes, issues des
+// mesures publiees de l'interpreteur VIP ; ils servent a budgeter une
+// frame, pas a une emulation au cycle pres.
+namespace vip {
+
+// Temps CPU disponible par frame de 1/60 s, une fois deduit le DMA
+// de l'affichage (CDP1861)
+constexpr int FRAME_BUDGET = 12000;
+
+// Cout d'une instruction
+int cycleCost(uint16_t opcode);
+
+// DXYN attend l'interruption d'affichage : la frame se termine apres lui
+inline bool waitsForVblank(uint16_t opcode) {
+  return (opcode & 0xF000) == 0xD000;
+}
+
+// Execute les instructions d'une frame (sans les timers). step() execute
+// une instruction et retourne faux pour interrompre (debugger). credit
+// reporte la dette d'une instruction longue sur la frame suivante.
+template <typename Step>
+void runFrame(const Chip8 &chip8, int &credit, Step step) {
+  credit += FRAME_BUDGET;
+  while (credit > 0) {
+    uint16_t pc = chip8.getPC();
+    uint16_t opcode = (chip8.peek(pc) << 8) | chip8.peek(pc + 1);
+    if (!step()) {
+      return;
+    }
+    credit -= cycleCost(opcode);
+    if (waitsForVblank(opcode)) {
+      credit = credit < 0 ? credit : 0;
+      return;
+    }
+  }
+}
+
+} // namespace vip
+
+#endif // TIMING_HPP
@@ -0,0 +1,465 @@
+#include "trace.hpp"
+#include <chrono>
+#include <cstring>
+
+static const char FILE_MAGIC[4] = {'C', '8', 'T', 'R'};
+static const char INDEX_MAGIC[4] = {'C', '8', 'I', 'X'};
+static const char END_MAGIC[4] = {'C', '8', 'T', 'E'};
+static constexpr uint32_t VERSION = 2;
+
+// En-tete de bloc : taille, enregistrements, premier index, pertes
+static constexpr size_t CHUNK_HEADER_SIZE = 24;
+
+// Drapeaux d'un enregistrement (apres les 16 bits de changedV)
+static constexpr uint32_t FLAG_I = 1u << 16;
+static constexpr uint32_t FLAG_SP = 1u << 17;
+static constexpr uint32_t FLAG_WRITES = 1u << 18;
+
+// --- Codage varint / zigzag ---
+
+static void putVarint(std::vector<uint8_t> &out, uint64_t value) {
+  while (value >= 0x80) {
+    out.push_back(static_cast<uint8_t>(value | 0x80));
+    value >>= 7;
+  }
+  out.push_back(static_cast<uint8_t>(value));
+}
+
+static uint64_t zigzag(int64_t value) {
+  return (static_cast<uint64_t>(value) << 1) ^
+         static_cast<uint64_t>(value >> 63);
+}
+
+static int64_t unzigzag(uint64_t value) {
+  return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+}
+
+static bool getVarint(const std::vector<uint8_t> &in, size_t &pos,
+                      uint64_t &value) {
+  value = 0;
+  for (int shift = 0; shift < 64 && pos < in.size(); shift += 7) {
+    uint8_t byte = in[pos++];
+    value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+    if (!(byte & 0x80))
+      return true;
+  }
+  return false;
+}
+
+static void putLE(std::vector<uint8_t> &out, uint64_t value, int bytes) {
+  for (int i = 0; i < bytes; ++i) {
+    out.push_back(static_cast<uint8_t>(value >> (8 * i)));
+  }
+}
+
+static uint64_t getLE(const uint8_t *in, int bytes) {
+  uint64_t value = 0;
+  for (int i = 0; i < bytes; ++i) {
+    value |= static_cast<uint64_t>(in[i]) << (8 * i);
+  }
+  return value;
+}
+
+// --- TraceWriter ---
+
+TraceWriter::TraceWriter(const std::string &path)
+    : ring(std::make_unique<SpscRing<TraceRecord, 1 << 16>>()) {
+  file = std::fopen(path.c_str(), "wb");
+  if (!file) {
+    return;
+  }
+
+  std::fwrite(FILE_MAGIC, 1, sizeof(FILE_MAGIC), file);
+  std::vector<uint8_t> version;
+  putLE(version, VERSION, 4);
+  std::fwrite(version.data(), 1, version.size(), file);
+
+  writer = std::thread(&TraceWriter::writerLoop, this);
+}
+
+TraceWriter::~TraceWriter() {
+  if (!file) {
+    return;
+  }
+
+  stopping = true;
+  writer.join();
+
+  // Index des blocs pour TraceReader::seek()
+  uint64_t footerOffset = static_cast<uint64_t>(std::ftell(file));
+  std::vector<uint8_t> footer(INDEX_MAGIC, INDEX_MAGIC + 4);
+  putLE(footer, chunks.size(), 4);
+  putLE(footer, droppedCount.load(), 8);
+  for (const auto &info : chunks) {
+    putLE(footer, info.firstIndex, 8);
+    putLE(footer, info.offset, 8);
+    putLE(footer, info.droppedBefore, 8);
+  }
+  putLE(footer, footerOffset, 8);
+  footer.insert(footer.end(), END_MAGIC, END_MAGIC + 4);
+  std::fwrite(footer.data(), 1, footer.size(), file);
+  std::fclose(file);
+}
+
+void TraceWriter::begin(const Chip8 &chip8) {
+  TraceRecord &r = pending;
+  r.pc = chip8.getPC();
+  r.opcode = (chip8.peek(r.pc) << 8) | chip8.peek(r.pc + 1);
+  for (int i = 0; i < Chip8::NUM_REGISTERS; ++i) {
+    r.V[i] = chip8.getV(i);
+  }
+  r.I = chip8.getI();
+  r.sp = chip8.getSP();
+
+  // Ecritures a venir : FX33 (3 octets) et FX55 (x + 1 octets) en I
+  r.writeCount = 0;
+  if ((r.opcode & 0xF0FF) == 0xF033) {
+    r.writeCount = 3;
+  } else if ((r.opcode & 0xF0FF) == 0xF055) {
+    r.writeCount = ((r.opcode >> 8) & 0x0F) + 1;
+  }
+  r.writeAddr = r.I;
+}
+
+void TraceWriter::end(const Chip8 &chip8) {
+  TraceRecord &r = pending;
+  r.index = nextIndex++;
+
+  r.changedV = 0;
+  for (int i = 0; i < Chip8::NUM_REGISTERS; ++i) {
+    uint8_t value = chip8.getV(i);
+    if (value != r.V[i]) {
+      r.changedV |= 1u << i;
+      r.V[i] = value;
+    }
+  }
+  r.changedI = chip8.getI() != r.I;
+  r.I = chip8.getI();
+  r.changedSP = chip8.getSP() != r.sp;
+  r.sp = chip8.getSP();
+  for (int i = 0; i < r.writeCount; ++i) {
+    r.writes[i] = chip8.peek(r.writeAddr + i);
+  }
+
+  r.droppedBefore = gap;
+  if (ring->push(r)) {
+    gap = 0;
+  } else {
+    ++gap;
+    ++droppedCount;
+  }
+}
+
+void TraceWriter::writerLoop() {
+  TraceRecord record;
+  while (true) {
+    // Lu avant de vider la file : a l'arret, tout est ecrit meme en pause
+    bool stop = stopping;
+    bool idle = true;
+    while ((stop || !writerPaused) && ring->pop(record)) {
+      encode(record);
+      idle = false;
+    }
+    if (idle) {
+      if (stop) {
+        break;
+      }
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+  }
+  flushChunk();
+}
+
+void TraceWriter::encode(const TraceRecord &record) {
+  // Le lecteur complete les registres non modifies avec l'enregistrement
+  // precedent : apres une perte, il faut repartir d'un etat complet
+  if (record.droppedBefore > 0) {
+    flushChunk();
+  }
+
+  // Etat du codage en delta, remis a zero a chaque bloc
+  bool keyframe = chunkCount == 0;
+  if (keyframe) {
+    chunkFirst = record.index;
+    chunkDropped = record.droppedBefore;
+    lastIndex = record.index - 1;
+    lastPc = -2;
+    lastI = 0;
+    chunk.clear();
+  }
+
+  putVarint(chunk, record.index - (lastIndex + 1));
+  putVarint(chunk, zigzag(record.pc - (lastPc + 2)));
+  chunk.push_back(static_cast<uint8_t>(record.opcode >> 8));
+  chunk.push_back(static_cast<uint8_t>(record.opcode));
+
+  uint32_t flags = record.changedV;
+  if (record.changedI)
+    flags |= FLAG_I;
+  if (record.changedSP)
+    flags |= FLAG_SP;
+  if (record.writeCount)
+    flags |= FLAG_WRITES;
+  putVarint(chunk, flags);
+
+  if (keyframe) {
+    // Premier enregistrement du bloc : etat complet, pour que seek()
+    // n'ait pas besoin des blocs precedents
+    chunk.insert(chunk.end(), record.V, record.V + Chip8::NUM_REGISTERS);
+    putLE(chunk, record.I, 2);
+    chunk.push_back(record.sp);
+    lastI = record.I;
+  } else {
+    for (int i = 0; i < Chip8::NUM_REGISTERS; ++i) {
+      if (record.changedV & (1u << i))
+        chunk.push_back(record.V[i]);
+    }
+    if (record.changedI) {
+      putVarint(chunk, zigzag(record.I - lastI));
+      lastI = record.I;
+    }
+    if (record.changedSP) {
+      chunk.push_back(record.sp);
+    }
+  }
+  if (record.writeCount) {
+    putVarint(chunk, record.writeAddr);
+    chunk.push_back(record.writeCount);
+    chunk.insert(chunk.end(), record.writes, record.writes + record.writeCount);
+  }
+
+  lastIndex = record.index;
+  lastPc = record.pc;
+
+  if (++chunkCount == CHUNK_RECORDS) {
+    flushChunk();
+  }
+}
+
+void TraceWriter::flushChunk() {
+  if (chunkCount == 0) {
+    return;
+  }
+
+  chunks.push_back(
+      {chunkFirst, static_cast<uint64_t>(std::ftell(file)), chunkDropped});
+
+  std::vector<uint8_t> header;
+  putLE(header, chunk.size(), 4);
+  putLE(header, chunkCount, 4);
+  putLE(header, chunkFirst, 8);
+  putLE(header, chunkDropped, 8);
+  std::fwrite(header.data(), 1, header.size(), file);
+  std::fwrite(chunk.data(), 1, chunk.size(), file);
+  std::fflush(file);
+
+  chunkCount = 0;
+}
+
+// --- TraceReader ---
+
+TraceReader::~TraceReader() {
+  if (file) {
+    std::fclose(file);
+  }
+}
+
+bool TraceReader::open(const std::string &path) {
+  file = std::fopen(path.c_str(), "rb");
+  if (!file) {
+    return false;
+  }
+
+  uint8_t header[8];
+  if (std::fread(header, 1, 8, file) != 8 ||
+      std::memcmp(header, FILE_MAGIC, 4) != 0 ||
+      getLE(header + 4, 4) != VERSION) {
+    return false;
+  }
+
+  // Index en fin de fichier
+  uint8_t tail[12];
+  if (std::fseek(file, -12, SEEK_END) == 0 &&
+      std::fread(tail, 1, 12, file) == 12 &&
+      std::memcmp(tail + 8, END_MAGIC, 4) == 0) {
+    uint64_t footerOffset = getLE(tail, 8);
+    uint8_t head[16];
+    std::fseek(file, static_cast<long>(footerOffset), SEEK_SET);
+    if (std::fread(head, 1, 16, file) == 16 &&
+        std::memcmp(head, INDEX_MAGIC, 4) == 0) {
+      uint32_t count = static_cast<uint32_t>(getLE(head + 4, 4));
+      droppedTotal = getLE(head + 8, 8);
+      for (uint32_t i = 0; i < count; ++i) {
+        uint8_t entry[24];
+        if (std::fread(entry, 1, 24, file) != 24)
+          break;
+        chunks.push_back(
+            {getLE(entry, 8), getLE(entry + 8, 8), getLE(entry + 16, 8)});
+      }
+      return loadChunk(0) || chunks.empty();
+    }
+  }
+
+  // Trace interrompue (pas d'index) : parcours des en-tetes de blocs.
+  // Les pertes apres le dernier bloc ecrit ne sont pas connues.
+  long offset = 8;
+  uint8_t chunkHeader[CHUNK_HEADER_SIZE];
+  while (std::fseek(file, offset, SEEK_SET) == 0 &&
+         std::fread(chunkHeader, 1, CHUNK_HEADER_SIZE, file) ==
+             CHUNK_HEADER_SIZE) {
+    uint64_t dropped = getLE(chunkHeader + 16, 8);
+    chunks.push_back(
+        {getLE(chunkHeader + 8, 8), static_cast<uint64_t>(offset), dropped});
+    droppedTotal += dropped;
+    offset += static_cast<long>(CHUNK_HEADER_SIZE + getLE(chunkHeader, 4));
+  }
+  return loadChunk(0) || chunks.empty();
+}
+
+bool TraceReader::loadChunk(size_t chunkIndex) {
+  if (chunkIndex >= chunks.size()) {
+    return false;
+  }
+
+  uint8_t header[CHUNK_HEADER_SIZE];
+  std::fseek(file, static_cast<long>(chunks[chunkIndex].offset), SEEK_SET);
+  if (std::fread(header, 1, CHUNK_HEADER_SIZE, file) != CHUNK_HEADER_SIZE) {
+    return false;
+  }
+
+  payload.resize(getLE(header, 4));
+  if (std::fread(payload.data(), 1, payload.size(), file) != payload.size()) {
+    return false; // Bloc tronque
+  }
+
+  currentChunk = chunkIndex;
+  remaining = static_cast<uint32_t>(getLE(header + 4, 4));
+  position = 0;
+  previous = TraceRecord{};
+  previous.index = getLE(header + 8, 8) - 1;
+  previous.pc = static_cast<uint16_t>(-2);
+  chunkDropped = getLE(header + 16, 8);
+  return true;
+}
+
+bool TraceReader::decode(TraceRecord &record) {
+  uint64_t value;
+  bool keyframe = position == 0;
+
+  if (!getVarint(payload, position, value))
+    return false;
+  record.index = previous.index + 1 + value;
+
+  if (!getVarint(payload, position, value))
+    return false;
+  record.pc = static_cast<uint16_t>(previous.pc + 2 + unzigzag(value));
+
+  if (position + 2 > payload.size())
+    return false;
+  record.opcode = (payload[position] << 8) | payload[position + 1];
+  position += 2;
+
+  uint64_t flags;
+  if (!getVarint(payload, position, flags))
+    return false;
+
+  record.changedV = flags & 0xFFFF;
+  record.changedI = flags & FLAG_I;
+  record.changedSP = flags & FLAG_SP;
+  record.droppedBefore = keyframe ? chunkDropped : 0;
+
+  if (keyframe) {
+    if (position + Chip8::NUM_REGISTERS + 3 > payload.size())
+      return false;
+    std::memcpy(record.V, &payload[position], Chip8::NUM_REGISTERS);
+    position += Chip8::NUM_REGISTERS;
+    record.I = static_cast<uint16_t>(getLE(&payload[position], 2));
+    record.sp = payload[position + 2];
+    position += 3;
+  } else {
+    // Les registres non modifies gardent leur valeur precedente
+    std::memcpy(record.V, previous.V, sizeof(record.V));
+    for (int i = 0; i < Chip8::NUM_REGISTERS; ++i) {
+      if (record.changedV & (1u << i)) {
+        if (position >= payload.size())
+          return false;
+        record.V[i] = payload[position++];
+      }
+    }
+
+    record.I = previous.I;
+    if (record.changedI) {
+      if (!getVarint(payload, position, value))
+        return false;
+      record.I = static_cast<uint16_t>(previous.I + unzigzag(value));
+    }
+
+    record.sp = previous.sp;
+    if (record.changedSP) {
+      if (position >= payload.size())
+        return false;
+      record.sp = payload[position++];
+    }
+  }
+
+  record.writeCount = 0;
+  if (flags & FLAG_WRITES) {
+    if (!getVarint(payload, position, value) || position >= payload.size())
+      return false;
+    record.writeAddr = static_cast<uint16_t>(value);
+    record.writeCount = payload[position++];
+    if (record.writeCount > Chip8::NUM_REGISTERS ||
+        position + record.writeCount > payload.size())
+      return false;
+    std::memcpy(record.writes, &payload[position], record.writeCount);
+    position += record.writeCount;
+  }
+
+  previous = record;
+  --remaining;
+  return true;
+}
+
+bool TraceReader::next(TraceRecord &record) {
+  while (remaining == 0) {
+    if (!loadChunk(currentChunk + 1))
+      return false;
+  }
+  return decode(record);
+}
+
+bool TraceReader::seek(uint64_t index) {
+  if (chunks.empty()) {
+    return false;
+  }
+
+  // Dernier bloc commencant avant index
+  size_t lo = 0;
+  size_t hi = chunks.size();
+  while (hi - lo > 1) {
+    size_t mid = (lo + hi) / 2;
+    if (chunks[mid].firstIndex <= index)
+      lo = mid;
+    else
+      hi = mid;
+  }
+  if (!loadChunk(lo)) {
+    return false;
+  }
+
+  // Avance jusqu'a l'instruction voulue en decodant sans la rendre
+  while (remaining > 0) {
+    size_t savedPosition = position;
+    TraceRecord savedPrevious = previous;
+    TraceRecord record;
+    if (!decode(record))
+      return false;
+    if (record.index >= index) {
+      position = savedPosition;
+      previous = savedPrevious;
+      ++remaining;
+      return true;
+    }
+  }
+  return true;
+}
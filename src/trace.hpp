@@ -0,0 +1,131 @@
+#ifndef TRACE_HPP
+#define TRACE_HPP
+
+#include "chip8.hpp"
+#include "spsc_ring.hpp"
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Une instruction executee et ses effets
+struct TraceRecord {
+  uint64_t index = 0;       // Numero d'instruction depuis le debut
+  uint16_t pc = 0;
+  uint16_t opcode = 0;
+  uint16_t changedV = 0;    // Bit r : V[r] modifie
+  bool changedI = false;
+  bool changedSP = false;
+  uint8_t V[Chip8::NUM_REGISTERS] = {}; // Nouvelles valeurs (bits changedV)
+  uint16_t I = 0;
+  uint8_t sp = 0;
+  uint16_t writeAddr = 0;   // Ecritures memoire contigues (FX33/FX55)
+  uint8_t writeCount = 0;
+  uint8_t writes[Chip8::NUM_REGISTERS] = {};
+  uint64_t droppedBefore = 0; // Instructions perdues juste avant
+};
+
+// Format de fichier : en-tete, puis blocs de TraceWriter::CHUNK_RECORDS
+// enregistrements codes en delta + varint, puis un index des blocs. Les
+// blocs sont ecrits des qu'ils sont pleins : un arret brutal ne perd que
+// le bloc en cours. Apres des enregistrements perdus, un nouveau bloc
+// commence (etat complet) et son en-tete note le nombre d'instructions
+// manquantes.
+
+// Enregistre la trace d'execution. begin()/end() encadrent chaque
+// instruction et ne font que remplir une file sans verrou ; la
+// compression et l'ecriture se font sur un thread dedie.
+class TraceWriter {
+public:
+  static constexpr size_t CHUNK_RECORDS = 4096;
+
+  explicit TraceWriter(const std::string &path);
+  ~TraceWriter(); // Vide la file et ecrit l'index
+
+  bool isOpen() const { return file != nullptr; }
+
+  void begin(const Chip8 &chip8);
+  void end(const Chip8 &chip8);
+
+  // Enregistrements perdus faute de place dans la file
+  uint64_t dropped() const { return droppedCount.load(); }
+
+  // Suspend le thread d'ecriture ; la file se remplit puis deborde
+  // (tests des pertes)
+  void setWriterPaused(bool paused) { writerPaused = paused; }
+
+private:
+  struct ChunkInfo {
+    uint64_t firstIndex;
+    uint64_t offset;
+    uint64_t droppedBefore;
+  };
+
+  std::FILE *file = nullptr;
+  std::unique_ptr<SpscRing<TraceRecord, 1 << 16>> ring;
+  std::thread writer;
+  std::atomic<bool> stopping{false};
+  std::atomic<bool> writerPaused{false};
+  std::atomic<uint64_t> droppedCount{0};
+
+  // Etat avant l'instruction courante (thread de l'emulateur)
+  TraceRecord pending;
+  uint64_t nextIndex = 0;
+  uint64_t gap = 0; // Pertes depuis le dernier enregistrement transmis
+
+  // Thread d'ecriture
+  std::vector<uint8_t> chunk;
+  uint32_t chunkCount = 0;
+  uint64_t chunkFirst = 0;
+  uint64_t chunkDropped = 0;
+  std::vector<ChunkInfo> chunks;
+  uint64_t lastIndex = 0;
+  int64_t lastPc = -2;
+  int64_t lastI = 0;
+
+  void writerLoop();
+  void encode(const TraceRecord &record);
+  void flushChunk();
+};
+
+// Relit une trace et se positionne sur n'importe quelle instruction
+class TraceReader {
+public:
+  bool open(const std::string &path);
+  ~TraceReader();
+
+  // Se place sur la premiere instruction d'index >= index
+  bool seek(uint64_t index);
+  bool next(TraceRecord &record);
+
+  size_t chunkCount() const { return chunks.size(); }
+  // Instructions perdues a l'enregistrement (file pleine)
+  uint64_t dropped() const { return droppedTotal; }
+
+private:
+  struct ChunkInfo {
+    uint64_t firstIndex;
+    uint64_t offset;
+    uint64_t droppedBefore;
+  };
+
+  std::FILE *file = nullptr;
+  std::vector<ChunkInfo> chunks;
+  uint64_t droppedTotal = 0;
+  size_t currentChunk = 0;
+
+  // Bloc decode en cours
+  std::vector<uint8_t> payload;
+  size_t position = 0;
+  uint32_t remaining = 0;
+  uint64_t chunkDropped = 0;
+  TraceRecord previous;
+
+  bool loadChunk(size_t chunkIndex);
+  bool decode(TraceRecord &record);
+};
+
+#endif // TRACE_HPP
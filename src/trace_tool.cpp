@@ -0,0 +1,74 @@
+#include "disasm.hpp"
+#include "trace.hpp"
+#include <cstdio>
+#include <iostream>
+#include <string>
+
+// chip8-trace : affiche une trace enregistree avec --trace
+int main(int argc, char *argv[]) {
+  std::string input;
+  uint64_t from = 0;
+  uint64_t count = 100;
+
+  for (int i = 1; i < argc; ++i) {
+    std::string arg = argv[i];
+    if (arg == "--from" && i + 1 < argc) {
+      from = std::stoull(argv[++i]);
+    } else if (arg == "--count" && i + 1 < argc) {
+      count = std::stoull(argv[++i]);
+    } else if (input.empty()) {
+      input = arg;
+    } else {
+      input.clear();
+      break;
+    }
+  }
+
+  if (input.empty()) {
+    std::cerr << "Usage: chip8-trace <trace.c8t> [--from N] [--count M]"
+              << std::endl;
+    return 1;
+  }
+
+  TraceReader reader;
+  if (!reader.open(input)) {
+    std::cerr << "Erreur: trace invalide " << input << std::endl;
+    return 1;
+  }
+  if (!reader.seek(from)) {
+    std::cerr << "Erreur: instruction " << from << " introuvable" << std::endl;
+    return 1;
+  }
+
+  if (reader.dropped() > 0) {
+    std::cerr << "Attention: " << reader.dropped()
+              << " instructions perdues a l'enregistrement (file pleine)"
+              << std::endl;
+  }
+
+  TraceRecord r;
+  for (uint64_t n = 0; n < count && reader.next(r); ++n) {
+    if (r.droppedBefore > 0) {
+      std::printf("%10s  -- %llu instructions perdues --\n", "",
+                  static_cast<unsigned long long>(r.droppedBefore));
+    }
+    std::printf("%10llu  %03X  %04X  %-18s",
+                static_cast<unsigned long long>(r.index), r.pc, r.opcode,
+                disassemble(r.opcode).c_str());
+    for (int i = 0; i < Chip8::NUM_REGISTERS; ++i) {
+      if (r.changedV & (1u << i))
+        std::printf(" V%X=%02X", i, r.V[i]);
+    }
+    if (r.changedI)
+      std::printf(" I=%03X", r.I);
+    if (r.changedSP)
+      std::printf(" SP=%u", r.sp);
+    if (r.writeCount) {
+      std::printf(" [%03X]=", r.writeAddr);
+      for (int i = 0; i < r.writeCount; ++i)
+        std::printf("%02X", r.writes[i]);
+    }
+    std::printf("\n");
+  }
+  return 0;
+}
@@ -0,0 +1,160 @@
+#include "wall.hpp"
+#include "sdl_display.hpp"
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <thread>
+
+static size_t workerCount() {
+  unsigned cores = std::thread::hardware_concurrency();
+  return cores > 0 ? cores : 1;
+}
+
+Wall::Wall(int columns, int rows)
+    : columns(columns), rows(rows), pool(workerCount()) {}
+
+bool Wall::load(const std::vector<std::string> &roms) {
+  if (roms.empty()) {
+    std::cerr << "Erreur: aucune ROM pour le mur" << std::endl;
+    return false;
+  }
+
+  // Chaque fichier n'est lu qu'une fois, meme repete sur la grille
+  std::map<std::string, size_t> loaded;
+  size_t count = static_cast<size_t>(columns * rows);
+  instances.clear();
+  instances.reserve(count);
+
+  for (size_t i = 0; i < count; ++i) {
+    const std::string &path = roms[i % roms.size()];
+    auto known = loaded.find(path);
+    if (known == loaded.end()) {
+      std::ifstream file(path, std::ios::binary);
+      images.emplace_back((std::istreambuf_iterator<char>(file)),
+                          std::istreambuf_iterator<char>());
+      known = loaded.emplace(path, images.size() - 1).first;
+    }
+
+    instances.push_back({Chip8(static_cast<uint32_t>(i + 1)), known->second});
+    const std::vector<uint8_t> &image = images[known->second];
+    if (image.empty() ||
+        !instances.back().chip8.loadROM(image.data(), image.size())) {
+      std::cerr << "Erreur de chargement de la ROM: " << path << std::endl;
+      return false;
+    }
+  }
+
+  changed.assign(count, 1);
+  return true;
+}
+
+void Wall::reset() {
+  for (Instance &instance : instances) {
+    const std::vector<uint8_t> &image = images[instance.rom];
+    instance.chip8.initialize();
+    instance.chip8.loadROM(image.data(), image.size());
+  }
+  std::fill(changed.begin(), changed.end(), 1);
+}
+
+void Wall::runFrame(int instructions, const uint8_t *keypad) {
+  // Un lot contigu d'instances par worker ; chaque instance n'est touchee
+  // que par un seul thread
+  size_t count = instances.size();
+  size_t batches = std::min(pool.size(), count);
+
+  for (size_t b = 0; b < batches; ++b) {
+    size_t first = count * b / batches;
+    size_t last = count * (b + 1) / batches;
+    pool.submit([this, first, last, instructions, keypad] {
+      for (size_t i = first; i < last; ++i) {
+        Chip8 &chip8 = instances[i].chip8;
+        for (int k = 0; k < 16; ++k) {
+          chip8.setKey(k, keypad[k] != 0);
+        }
+        chip8.runFrame(instructions);
+        if (chip8.drawFlag) {
+          changed[i] = 1;
+          chip8.drawFlag = false;
+        }
+      }
+    });
+  }
+  pool.wait();
+}
+
+void Wall::run(SdlDisplay &display) {
+  const auto frameDuration = std::chrono::microseconds(1000000 / 60);
+  int instructionsPerSecond = 500;
+  int instructionCredit = 0;
+  bool paused = false;
+  long frames = 0;
+  long lateFrames = 0; // Frames non tenues en 1/60 s
+
+  uint8_t keypad[16] = {0};
+  std::vector<const uint8_t *> framebuffers(instances.size());
+  auto nextFrame = std::chrono::steady_clock::now();
+
+  for (bool running = true; running;) {
+    switch (display.processEvents(keypad)) {
+    case InputEvent::Quit:
+      running = false;
+      break;
+    case InputEvent::Pause:
+      paused = !paused;
+      break;
+    case InputEvent::Reset:
+      reset();
+      std::fill(keypad, keypad + 16, 0);
+      break;
+    case InputEvent::SpeedUp:
+      instructionsPerSecond = std::min(2000, instructionsPerSecond + 100);
+      std::cout << "Vitesse: " << instructionsPerSecond << " Hz" << std::endl;
+      break;
+    case InputEvent::SpeedDown:
+      instructionsPerSecond = std::max(100, instructionsPerSecond - 100);
+      std::cout << "Vitesse: " << instructionsPerSecond << " Hz" << std::endl;
+      break;
+    default:
+      break;
+    }
+
+    if (!paused) {
+      instructionCredit += instructionsPerSecond;
+      runFrame(instructionCredit / 60, keypad);
+      instructionCredit %= 60;
+      ++frames;
+    }
+
+    if (std::find(changed.begin(), changed.end(), 1) != changed.end()) {
+      for (size_t i = 0; i < instances.size(); ++i) {
+        framebuffers[i] = instances[i].chip8.display.data();
+      }
+      display.renderTiles(framebuffers.data(), changed.data(),
+                          static_cast<int>(instances.size()));
+      std::fill(changed.begin(), changed.end(), 0);
+    }
+
+    // Attente de la frame suivante (sans derive)
+    nextFrame += frameDuration;
+    auto now = std::chrono::steady_clock::now();
+    if (nextFrame > now) {
+      std::this_thread::sleep_until(nextFrame);
+    } else {
+      nextFrame = now; // En retard : on ne rattrape pas
+      ++lateFrames;
+    }
+  }
+
+  // Bilan pour les tests d'endurance
+  uint64_t unknown = 0;
+  for (const Instance &instance : instances) {
+    unknown += instance.chip8.getUnknownOpcodes();
+  }
+  std::cout << "Mur " << columns << "x" << rows << " : " << frames
+            << " frames, " << lateFrames << " en retard, " << unknown
+            << " opcodes inconnus" << std::endl;
+}
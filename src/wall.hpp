@@ -0,0 +1,45 @@
+#ifndef WALL_HPP
+#define WALL_HPP
+
+#include "chip8.hpp"
+#include "thread_pool.hpp"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class SdlDisplay;
+
+// Mur d'emulateurs : une grille d'instances Chip8 dans un seul processus.
+// Chaque frame est repartie sur un pool de workers, puis les ecrans sont
+// composes dans une seule fenetre ; seules les tuiles redessinees sont
+// recopiees dans la texture.
+class Wall {
+public:
+  Wall(int columns, int rows);
+
+  // Repartit les ROMs en boucle sur la grille. Chaque instance a sa propre
+  // graine : une seule ROM donne autant de parties differentes.
+  bool load(const std::vector<std::string> &roms);
+
+  // Boucle a 60 Hz jusqu'a la fermeture. Le clavier est envoye a toutes
+  // les instances ; Espace, F5 et +/- agissent sur tout le mur.
+  void run(SdlDisplay &display);
+
+private:
+  struct Instance {
+    Chip8 chip8;
+    size_t rom; // Index dans images
+  };
+
+  int columns;
+  int rows;
+  std::vector<Instance> instances;
+  std::vector<std::vector<uint8_t>> images; // Contenu des ROMs chargees
+  std::vector<uint8_t> changed;             // Tuiles a recopier
+  ThreadPool pool;
+
+  void reset();
+  void runFrame(int instructions, const uint8_t *keypad);
+};
+
+#endif // WALL_HPP
@@ -0,0 +1,77 @@
+// Acces memoire en fin d'espace d'adressage : I et PC proches de 0xFFF
+// bouclent sur 0x000 au lieu de sortir de la memoire.
+
+#include "chip8.hpp"
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+static int failures = 0;
+
+static void expect(bool ok, const char *what) {
+  if (!ok) {
+    std::cerr << "Echec: " << what << std::endl;
+    ++failures;
+  }
+}
+
+int main() {
+  std::vector<uint8_t> rom;
+  auto op = [&rom](uint16_t opcode) {
+    rom.push_back(static_cast<uint8_t>(opcode >> 8));
+    rom.push_back(static_cast<uint8_t>(opcode));
+  };
+
+  for (int r = 0; r < 16; ++r) // V[r] = 0x10 + r
+    op(static_cast<uint16_t>(0x6010 | (r << 8) | r));
+  op(0xAFF8); // I = 0xFF8
+  op(0xFF55); // V0-VF -> 0xFF8-0xFFF puis 0x000-0x007
+  for (int r = 0; r < 16; ++r)
+    op(static_cast<uint16_t>(0x6000 | (r << 8)));
+  op(0xAFF8);
+  op(0xFF65); // Relecture des 16 octets
+  op(0x60FE); // V0 = 254
+  op(0xAFFF);
+  op(0xF033); // BCD : 0xFFF, 0x000, 0x001
+  op(0x6102);
+  op(0xF11E); // I = 0x1001, au-dela de la memoire
+  op(0xF065); // V0 = memory[0x001]
+
+  Chip8 chip8(0);
+  if (!chip8.loadROM(rom.data(), rom.size())) {
+    std::cerr << "Echec: chargement de la ROM" << std::endl;
+    return 1;
+  }
+  for (size_t i = 0; i < rom.size() / 2; ++i) {
+    chip8.cycle();
+  }
+
+  expect(chip8.peek(0xFFE) == 0x16, "FX55 ecrit 0xFFE");
+  expect(chip8.peek(0x007) == 0x1F, "FX55 boucle sur 0x000");
+  expect(chip8.getV(0x8) == 0x18, "FX65 relit 0x000");
+  expect(chip8.getV(0xF) == 0x1F, "FX65 relit 0x007");
+  expect(chip8.peek(0xFFF) == 2 && chip8.peek(0x000) == 5 &&
+             chip8.peek(0x001) == 4,
+         "FX33 boucle sur 0x000");
+  expect(chip8.getV(0x0) == 4, "FX65 avec I > 0xFFF");
+  expect(chip8.getUnknownOpcodes() == 0, "aucun opcode inconnu");
+
+  // Instruction a cheval sur 0xFFF et 0x000 : JP 0x508
+  rom.clear();
+  op(0x6015);
+  op(0x6108);
+  op(0xAFFF);
+  op(0xF155);
+  op(0x1FFF);
+  Chip8 fetch(0);
+  fetch.loadROM(rom.data(), rom.size());
+  for (int i = 0; i < 6; ++i) {
+    fetch.cycle();
+  }
+  expect(fetch.getPC() == 0x508, "fetch en 0xFFF");
+
+  if (failures == 0) {
+    std::cout << "memory_wrap: OK" << std::endl;
+  }
+  return failures == 0 ? 0 : 1;
+}
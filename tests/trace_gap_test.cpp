@@ -0,0 +1,131 @@
+// Trace avec enregistrements perdus : chaque instruction relue doit porter
+// les registres de l'interpreteur, meme juste apres une perte.
+
+#include "chip8.hpp"
+#include "trace.hpp"
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+int main() {
+  // Boucle qui modifie des registres a chaque instruction
+  const std::vector<uint8_t> rom = {
+      0x70, 0x01, // ADD V0, 1
+      0x71, 0x03, // ADD V1, 3
+      0x72, 0x07, // ADD V2, 7
+      0xF0, 0x1E, // ADD I, V0
+      0x80, 0x14, // ADD V0, V1 (VF = retenue)
+      0x12, 0x00, // JP 0x200
+  };
+  const std::string path = "trace_gap_test.c8t";
+
+  // Thread d'ecriture suspendu : la file de 65536 enregistrements deborde.
+  // Plusieurs pertes, separees par des instructions bien enregistrees.
+  uint64_t executed = 0;
+  uint64_t dropped = 0;
+  {
+    Chip8 chip8(0);
+    chip8.loadROM(rom.data(), rom.size());
+    TraceWriter tracer(path);
+    if (!tracer.isOpen()) {
+      std::cerr << "Echec: impossible d'ecrire " << path << std::endl;
+      return 1;
+    }
+    auto run = [&](uint64_t count) {
+      for (uint64_t i = 0; i < count; ++i) {
+        tracer.begin(chip8);
+        chip8.cycle();
+        tracer.end(chip8);
+        ++executed;
+      }
+    };
+    // Laisse le thread d'ecriture vider la file
+    auto drain = [] {
+      std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    };
+    run(1000);
+    drain();
+    for (int round = 0; round < 3; ++round) {
+      tracer.setWriterPaused(true);
+      run(100000);
+      tracer.setWriterPaused(false);
+      run(5000 + 1000 * round);
+      drain();
+    }
+    tracer.setWriterPaused(true);
+    run(80000); // Pertes finales, connues seulement de l'index
+    dropped = tracer.dropped();
+  }
+
+  if (dropped == 0) {
+    std::cerr << "Echec: aucune perte provoquee" << std::endl;
+    return 1;
+  }
+
+  TraceReader reader;
+  if (!reader.open(path)) {
+    std::cerr << "Echec: relecture de la trace" << std::endl;
+    return 1;
+  }
+
+  // Rejoue l'interpreteur jusqu'a chaque instruction relue
+  Chip8 reference(0);
+  reference.loadROM(rom.data(), rom.size());
+  uint64_t replayed = 0;
+  uint64_t records = 0;
+  uint64_t gaps = 0;
+  uint64_t mismatches = 0;
+  uint64_t reported = 0;
+  TraceRecord record;
+  while (reader.next(record)) {
+    // Chaque saut de numerotation est annonce par l'enregistrement suivant
+    if (record.index != replayed + record.droppedBefore) {
+      std::cerr << "Echec: saut avant " << record.index << " mal signale"
+                << std::endl;
+      return 1;
+    }
+    while (replayed <= record.index) {
+      reference.cycle();
+      ++replayed;
+    }
+
+    bool same = record.I == reference.getI() &&
+                record.sp == reference.getSP();
+    for (int i = 0; i < Chip8::NUM_REGISTERS; ++i) {
+      same = same && record.V[i] == reference.getV(i);
+    }
+    if (!same) {
+      ++mismatches;
+    }
+    if (record.droppedBefore > 0) {
+      ++gaps;
+      reported += record.droppedBefore;
+    }
+    ++records;
+  }
+  std::remove(path.c_str());
+
+  int failures = 0;
+  if (mismatches > 0) {
+    std::cerr << "Echec: " << mismatches << " enregistrements sur " << records
+              << " ne correspondent pas a l'interpreteur" << std::endl;
+    ++failures;
+  }
+  if (gaps == 0 || reported > reader.dropped() ||
+      reader.dropped() != dropped) {
+    std::cerr << "Echec: pertes mal signalees (" << reported << " dans les "
+              << "blocs, " << reader.dropped() << " dans l'index, " << dropped
+              << " a l'ecriture)" << std::endl;
+    ++failures;
+  }
+  if (records + dropped != executed) {
+    std::cerr << "Echec: " << records << " relus + " << dropped
+              << " perdus != " << executed << std::endl;
+    ++failures;
+  }
+  return failures == 0 ? 0 : 1;
+}